@@ -252,12 +252,13 @@ class ClassData:
 
         def make_member(x):
             if self.meta_defer_drop and x.is_static:
-                # Use our "deferDrop" ability on static members.
+                # Use our "deferDrop" ability on static members: the class
+                # ref is kept once a static member is actually used, since
+                # dropping it again would force a lookup on every call.
                 return x.get_wrapper_defn(self.type.cpp_classname,
                                           context,
                                           meta_instance='data',
-                                          before='auto &data = Meta::data(true);',
-                                          after='data.dropClassRef();')
+                                          before='auto &data = Meta::data(true);')
             return x.get_wrapper_defn(self.type.cpp_classname, context)
         members = [make_member(x) for x in self.members]
         return '\n\n'.join(members)
@@ -167,12 +167,27 @@ class Method(Member):
         return fwd_decls
 
     def get_meta_decl(self, context=None):
-        """Get the member declaration for the C++ Meta structure."""
-        return f"jni::method_t {self.decorated_name};"
+        """
+        Get the member declaration for the C++ Meta structure.
+
+        >>> Method("setColor", "(I)V").get_meta_decl()
+        'impl::MethodId<void(int32_t)> setColor;'
+
+        >>> Method("mapLibraryName", "(Ljava/lang/String;)Ljava/lang/String;", is_static=True).get_meta_decl()
+        'impl::StaticMethodId<std::string(std::string)> mapLibraryName;'
+        """
+        param_types = ', '.join(t.jnipp_return_type for t in self.params)
+        return (f"impl::{self.static_capitalized}MethodId<{self.return_type.jnipp_return_type}({param_types})> "
+                f"{self.decorated_name};")
 
     def get_meta_initializer(self):
-        """Get the member initializer for the C++ Meta constructor."""
-        return f'{self.decorated_name}(classRef().get{self.static_capitalized}Method("{self.name}", "{self.signature}"))'
+        """
+        Get the member initializer for the C++ Meta constructor.
+
+        >>> Method("setColor", "(I)V").get_meta_initializer()
+        'setColor(classRef(), "setColor", "(I)V")'
+        """
+        return f'{self.decorated_name}(classRef(), "{self.name}", "{self.signature}")'
 
     def get_comment_text(self):
         """Get the text of the comment."""
@@ -185,9 +200,14 @@ class Method(Member):
         for t in self.params:
             t.apply_visitor(visitor)
 
-    @property
-    def _invocation_method(self):
-        return f'call<{self.return_type.jnipp_return_type}>'
+    def _get_call_expression(self, meta_instance, args):
+        """
+        Get the expression invoking this method with the given argument expressions.
+
+        The types are encoded in the Meta member type.
+        """
+        args = [self.get_invocation_target(meta_instance)] + args
+        return f'{meta_instance}.{self.decorated_name}.call({", ".join(args)})'
 
     @property
     def _wrapper_name(self):
@@ -251,18 +271,11 @@ class Method(Member):
             ')',
         ])
 
-        args = [f'{meta_instance}.{self.decorated_name}']
-        args.extend(t.get_as_jnipp_param(n)
-                    for t, n in zip(self.params, param_names))
-
-        call = [
-            self.get_invocation_target(meta_instance),
-            f'.{self._invocation_method}(',
-            ', '.join(args),
-            ')',
-        ]
+        args = [t.get_as_jnipp_param(n)
+                for t, n in zip(self.params, param_names)]
 
-        call_str = self.return_type.convert_expression_from_jnipp(''.join(call), context)
+        call_str = self.return_type.convert_expression_from_jnipp(
+            self._get_call_expression(meta_instance, args), context)
         return self.make_wrapper_impl(
             decl=' '.join(decl),
             return_expression=call_str,
@@ -296,6 +309,10 @@ class Constructor(Method):
         """
         return set()
 
+    def get_meta_decl(self, context=None):
+        """Get the member declaration for the C++ Meta structure."""
+        return f"jni::method_t {self.decorated_name};"
+
     def get_meta_initializer(self):
         """Get the member initializer for the C++ Meta constructor."""
         return f'{self.decorated_name}(classRef().getMethod("{self.name}", "{self.signature}"))'
@@ -315,9 +332,10 @@ class Constructor(Method):
         """Get the text of the comment."""
         return f'Wrapper for a constructor'
 
-    @property
-    def _invocation_method(self):
-        return f'newInstance'
+    def _get_call_expression(self, meta_instance, args):
+        """Get the expression invoking this constructor with the given argument expressions."""
+        args = [f'{meta_instance}.{self.decorated_name}'] + args
+        return f'{self.get_invocation_target(meta_instance)}.newInstance({", ".join(args)})'
 
     @property
     def _wrapper_name(self):
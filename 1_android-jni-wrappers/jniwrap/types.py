@@ -27,7 +27,7 @@ _LETTERS_FOR_TYPES = {typename: letter
 # slashed name to the C++ version known by JNIPP
 _JNI_TO_CPP = {
     'boolean': 'bool',
-    'byte': 'int8_t',
+    'byte': 'jni::byte_t',
     'char': 'uint16_t',
     'short': 'int16_t',
     'int': 'int32_t',
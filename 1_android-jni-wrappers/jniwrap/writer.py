@@ -138,6 +138,7 @@ class WrapperWriter:
         self.external_include_path = ""
         self.external_include_prefixes = []
         self.header_extension = 'h'
+        self.preload_all = False
 
     def handle_arg(self, arg):
         if arg in self.data:
@@ -254,6 +255,31 @@ class WrapperWriter:
             fp.write(_end_body(package_components))
             fp.write('\n')
 
+    def write_preload_all(self):
+        self._log.info("Writing preloadAll")
+        includes = []
+        class_names = []
+        for package, classes in self.package_data.items():
+            if not classes:
+                continue
+            includes.append(self._process_include(f'"{package}.{self.header_extension}"'))
+            class_names.extend(qualified_name_parts_to_qualified_cpp(classdata.type.cpp_parts[:])
+                               for classdata in classes)
+
+        with open('wrap/PreloadAll.cpp', 'w') as fp:
+            self._write_copyright(fp)
+            fp.write(f'#include "Preload.{self.header_extension}"\n')
+            for f in sorted(includes):
+                fp.write(f'#include {f}\n')
+            fp.write('\n')
+            fp.write(_open_namespace('wrap'))
+            fp.write('\n')
+            fp.write('void preloadAll() {\n')
+            fp.write(f'    preload<{", ".join(class_names)}>();\n')
+            fp.write('}\n')
+            fp.write(_close_namespace('wrap'))
+            fp.write('\n')
+
     def _should_generate_for_package(self, package):
         if self.only_this_package and self.only_this_package != package:
             return False
@@ -276,6 +302,7 @@ class WrapperWriter:
         if header_extension:
             self._include_fixer.nondefault_header_ext = header_extension
             self.header_extension = header_extension
+        self.preload_all = options.get('preloadAll', self.preload_all)
 
     def load_classes(self):
         self._log.info("Loading classes")
@@ -338,3 +365,6 @@ class WrapperWriter:
             self.write_package_header(package, classes)
             self.write_package_impl(package, classes)
             self.write_package_impl_header(package, classes)
+        # Only meaningful when everything is being generated.
+        if self.preload_all and not self.only_this_package:
+            self.write_preload_all()
@@ -0,0 +1,87 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "CursorReader.h"
+
+#include <jnipp.h>
+
+namespace wrap {
+namespace {
+/*!
+ * Append the modified UTF-8 form of @p str to @p arena.
+ */
+void appendString(JNIEnv *env, jstring str, std::string &arena) {
+    auto offset = arena.size();
+    auto bytes = std::size_t(env->GetStringUTFLength(str));
+    // Leave room for the terminator some implementations write.
+    arena.resize(offset + bytes + 1);
+    env->GetStringUTFRegion(str, 0, env->GetStringLength(str), &arena[offset]);
+    arena.resize(offset + bytes);
+}
+
+void checkException(JNIEnv *env) {
+    if (env->ExceptionCheck()) {
+        jni::internal::checkJavaExceptions();
+    }
+}
+} // namespace
+
+CursorReader::CursorReader(android::database::Cursor cursor,
+                           std::vector<Column> columns, std::size_t batchSize)
+    : cursor_(std::move(cursor)), batchSize_(batchSize) {
+    columns_.reserve(columns.size());
+    for (auto &column : columns) {
+        auto index = cursor_.getColumnIndex(column.name);
+        if (index < 0) {
+            throw jni::NameResolutionException(column.name.c_str());
+        }
+        columns_.push_back(ColumnData{column.type, index, {}, {}, {}});
+    }
+}
+
+std::size_t CursorReader::fetch() {
+    for (auto &column : columns_) {
+        column.ints.clear();
+        column.offsets.assign(1, 0);
+        column.arena.clear();
+    }
+    rows_ = 0;
+    if (exhausted_) {
+        return 0;
+    }
+
+    auto &meta = android::database::Cursor::Meta::data();
+    JNIEnv *env = jni::env();
+    jobject cursor = cursor_.object().getHandle();
+
+    // Releases the current string if a call throws part way through a row.
+    jni::LocalFrame frame(env, 4);
+
+    while (rows_ < batchSize_) {
+        bool more = env->CallBooleanMethod(cursor, meta.moveToNext.id);
+        checkException(env);
+        if (!more) {
+            exhausted_ = true;
+            break;
+        }
+        for (auto &column : columns_) {
+            if (column.type == ColumnType::Int) {
+                column.ints.push_back(
+                    env->CallIntMethod(cursor, meta.getInt.id, column.index));
+                checkException(env);
+            } else {
+                auto str = static_cast<jstring>(env->CallObjectMethod(
+                    cursor, meta.getString.id, column.index));
+                checkException(env);
+                if (str != nullptr) {
+                    appendString(env, str, column.arena);
+                    env->DeleteLocalRef(str);
+                }
+                column.offsets.push_back(column.arena.size());
+            }
+        }
+        ++rows_;
+    }
+    return rows_;
+}
+} // namespace wrap
@@ -0,0 +1,106 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "android.database.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace wrap {
+/*!
+ * Reads the rows of an android.database.Cursor in batches, into columnar
+ * storage.
+ *
+ * Column indices are looked up once, on construction. Each fetch() then walks
+ * up to `batchSize` rows with a single JNI environment lookup, storing int
+ * columns in a `std::vector<int32_t>` and string columns in one contiguous
+ * arena per column, rather than creating a std::string per cell.
+ *
+ * The values from a batch stay valid until the next call to fetch().
+ */
+class CursorReader {
+  public:
+    /*!
+     * How a column is read from the cursor.
+     */
+    enum class ColumnType { Int, String };
+
+    /*!
+     * A column to read, by name.
+     */
+    struct Column {
+        std::string name;
+        ColumnType type;
+    };
+
+    /*!
+     * Prepare to read @p columns from @p cursor, starting at its next row.
+     *
+     * @throws jni::NameResolutionException if a column does not exist.
+     */
+    CursorReader(android::database::Cursor cursor, std::vector<Column> columns,
+                 std::size_t batchSize = 64);
+
+    /*!
+     * Read the next batch of rows, replacing the previous one.
+     *
+     * @return the number of rows read, which is 0 once the cursor is
+     * exhausted.
+     */
+    std::size_t fetch();
+
+    /*!
+     * Number of rows in the current batch.
+     */
+    std::size_t rows() const noexcept { return rows_; }
+
+    /*!
+     * All values of int column @p column in the current batch.
+     *
+     * @param column The position of the column in the list given on
+     * construction.
+     */
+    std::vector<int32_t> const &ints(std::size_t column) const {
+        return columns_[column].ints;
+    }
+
+    /*!
+     * Value of int column @p column in row @p row of the current batch.
+     */
+    int32_t getInt(std::size_t column, std::size_t row) const {
+        return columns_[column].ints[row];
+    }
+
+    /*!
+     * Value of string column @p column in row @p row of the current batch.
+     *
+     * A null string reads as empty.
+     */
+    std::string_view getString(std::size_t column, std::size_t row) const {
+        auto const &data = columns_[column];
+        return std::string_view(data.arena).substr(
+            data.offsets[row], data.offsets[row + 1] - data.offsets[row]);
+    }
+
+  private:
+    struct ColumnData {
+        ColumnType type;
+        int32_t index;
+        std::vector<int32_t> ints;
+        //! Start of each row's string in arena, plus the end of the last.
+        std::vector<std::size_t> offsets;
+        std::string arena;
+    };
+
+    android::database::Cursor cursor_;
+    std::vector<ColumnData> columns_;
+    std::size_t batchSize_;
+    std::size_t rows_ = 0;
+    bool exhausted_ = false;
+};
+} // namespace wrap
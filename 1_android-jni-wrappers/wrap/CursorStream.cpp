@@ -0,0 +1,101 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "CursorStream.h"
+
+#include <jnipp.h>
+
+#include <utility>
+
+namespace wrap {
+CursorStream::CursorStream(android::database::Cursor cursor,
+                           std::vector<CursorReader::Column> const &columns,
+                           std::size_t batchSize)
+    : cursor_(std::move(cursor)) {
+    for (auto &reader : readers_) {
+        reader = std::make_unique<CursorReader>(cursor_, columns, batchSize);
+    }
+    thread_ = std::thread([this] { run(); });
+}
+
+CursorStream::~CursorStream() { cancel(); }
+
+CursorReader const *CursorStream::next() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (holding_) {
+        holding_ = false;
+        ++released_;
+        cv_.notify_all();
+    }
+    cv_.wait(lock, [&] {
+        return taken_ < produced_ || finished_ || cancelled_;
+    });
+    if (cancelled_) {
+        return nullptr;
+    }
+    if (taken_ < produced_) {
+        holding_ = true;
+        return readers_[taken_++ % 2].get();
+    }
+    if (error_) {
+        std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+    return nullptr;
+}
+
+void CursorStream::cancel() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cancelled_ = true;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void CursorStream::close() {
+    cancel();
+    cursor_.close();
+}
+
+void CursorStream::run() {
+    try {
+        // Attach this thread, if needed, before fetching anything.
+        jni::env();
+        for (;;) {
+            std::size_t slot;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [&] {
+                    return cancelled_ || produced_ - released_ < 2;
+                });
+                if (cancelled_) {
+                    return;
+                }
+                slot = produced_ % 2;
+            }
+            auto rows = readers_[slot]->fetch();
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (rows == 0) {
+                    finished_ = true;
+                } else {
+                    ++produced_;
+                }
+            }
+            cv_.notify_all();
+            if (rows == 0) {
+                return;
+            }
+        }
+    } catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            error_ = std::current_exception();
+            finished_ = true;
+        }
+        cv_.notify_all();
+    }
+}
+} // namespace wrap
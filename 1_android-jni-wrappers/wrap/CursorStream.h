@@ -0,0 +1,139 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "CursorReader.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace wrap {
+/*!
+ * Iterates the rows of an android.database.Cursor in batches, fetching the
+ * next batch on a background thread while the current one is processed.
+ *
+ * The background thread is attached to the JVM and fills two CursorReader
+ * buffers in turn: it never gets more than one batch ahead of the consumer,
+ * so a slow consumer holds back the fetching rather than letting it buffer
+ * the whole result set.
+ *
+ * Usage:
+ *
+ *     CursorStream stream(cursor, {{"_id", CursorReader::ColumnType::Int}});
+ *     for (CursorReader const &batch : stream) {
+ *         for (size_t row = 0; row < batch.rows(); ++row) { ... }
+ *     }
+ *     stream.close();
+ *
+ * Worker threads attached from native code only see the system class loader,
+ * which is fine here since the Cursor method IDs are resolved on construction.
+ */
+class CursorStream {
+  public:
+    /*!
+     * Start fetching @p columns from @p cursor, from its next row onwards.
+     *
+     * @throws jni::NameResolutionException if a column does not exist.
+     */
+    CursorStream(android::database::Cursor cursor,
+                 std::vector<CursorReader::Column> const &columns,
+                 std::size_t batchSize = 64);
+
+    /*!
+     * Stops the background thread. Does not close the cursor.
+     */
+    ~CursorStream();
+
+    CursorStream(CursorStream const &) = delete;
+    CursorStream &operator=(CursorStream const &) = delete;
+
+    /*!
+     * Wait for the next batch of rows.
+     *
+     * The batch returned by the previous call is handed back to the
+     * background thread, so it must no longer be used.
+     *
+     * @return the batch, or nullptr once the cursor is exhausted or the
+     * stream was cancelled. If fetching failed, the exception is rethrown
+     * here, after the batches fetched before it.
+     */
+    CursorReader const *next();
+
+    /*!
+     * Stop fetching and wait for the background thread to finish its
+     * current batch. Afterwards, next() returns nullptr.
+     */
+    void cancel();
+
+    /*!
+     * Cancel the stream, then close the underlying cursor.
+     */
+    void close();
+
+    /*!
+     * Input iterator over the batches of a CursorStream.
+     */
+    class iterator {
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = CursorReader;
+        using difference_type = std::ptrdiff_t;
+        using pointer = CursorReader const *;
+        using reference = CursorReader const &;
+
+        reference operator*() const { return *batch_; }
+        pointer operator->() const { return batch_; }
+        iterator &operator++() {
+            batch_ = stream_->next();
+            return *this;
+        }
+        bool operator==(iterator const &other) const {
+            return batch_ == other.batch_;
+        }
+        bool operator!=(iterator const &other) const {
+            return batch_ != other.batch_;
+        }
+
+      private:
+        friend class CursorStream;
+        iterator(CursorStream *stream, CursorReader const *batch)
+            : stream_(stream), batch_(batch) {}
+
+        CursorStream *stream_;
+        CursorReader const *batch_;
+    };
+
+    /*!
+     * Wait for the first batch. Iterating a stream consumes it.
+     */
+    iterator begin() { return iterator(this, next()); }
+
+    iterator end() { return iterator(this, nullptr); }
+
+  private:
+    void run();
+
+    android::database::Cursor cursor_;
+    std::unique_ptr<CursorReader> readers_[2];
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    //! Batches filled by the background thread.
+    std::size_t produced_ = 0;
+    //! Batches handed to the consumer.
+    std::size_t taken_ = 0;
+    //! Batches handed back by the consumer, free to be filled again.
+    std::size_t released_ = 0;
+    bool holding_ = false;
+    bool finished_ = false;
+    bool cancelled_ = false;
+    std::exception_ptr error_;
+    std::thread thread_;
+};
+} // namespace wrap
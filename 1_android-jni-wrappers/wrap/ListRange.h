@@ -0,0 +1,139 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "java.util.h"
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace wrap {
+/*!
+ * Range over the elements of a java.util.List, for use in a range-based for.
+ *
+ * Each element is fetched as a JNI local reference and deleted once the
+ * iteration moves past it, instead of creating (and later deleting) a global
+ * reference per element. The element is converted to @p T, which may be
+ * jni::Object or any generated wrapper type, for example
+ * `ListRange<android::content::pm::ResolveInfo>`.
+ *
+ * Elements are only valid until the iteration advances: copy out what you
+ * need, or use toVector() to keep them. Iterate on a single thread.
+ *
+ * The range holds its own reference to the list, so it can be built from a
+ * temporary, as in
+ * `for (auto &e : ListRange<ResolveInfo>(pm.queryIntentServices(intent, 0)))`.
+ */
+template <typename T = jni::Object> class ListRange {
+  public:
+    /*!
+     * Range over the elements of @p list. The size is read once, here.
+     */
+    explicit ListRange(java::util::List list)
+        : list_(std::move(list)),
+          size_(java::util::List::Meta::data().size.call(list_.object())) {}
+
+    class iterator {
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T const *;
+        using reference = T const &;
+
+        iterator(iterator const &) = delete;
+        iterator(iterator &&other) noexcept
+            : env_(other.env_), list_(other.list_), index_(other.index_),
+              size_(other.size_), local_(std::exchange(other.local_, nullptr)),
+              element_(std::move(other.element_)) {}
+        ~iterator() { release(); }
+
+        reference operator*() const { return element_; }
+        pointer operator->() const { return &element_; }
+        iterator &operator++() {
+            ++index_;
+            load();
+            return *this;
+        }
+        bool operator!=(iterator const &other) const {
+            return index_ != other.index_;
+        }
+        bool operator==(iterator const &other) const {
+            return index_ == other.index_;
+        }
+
+      private:
+        friend class ListRange;
+        iterator(JNIEnv *env, jobject list, int32_t index, int32_t size)
+            : env_(env), list_(list), index_(index), size_(size) {
+            load();
+        }
+
+        void release() {
+            if (local_ != nullptr) {
+                element_ = T{};
+                env_->DeleteLocalRef(local_);
+                local_ = nullptr;
+            }
+        }
+
+        void load() {
+            release();
+            if (index_ >= size_) {
+                return;
+            }
+            local_ = env_->CallObjectMethod(
+                list_, java::util::List::Meta::data().get.id, jint(index_));
+            if (env_->ExceptionCheck()) {
+                jni::internal::checkJavaExceptions();
+            }
+            element_ = T(jni::Object(local_, jni::Object::Temporary));
+        }
+
+        JNIEnv *env_;
+        jobject list_;
+        int32_t index_;
+        int32_t size_;
+        jobject local_ = nullptr;
+        T element_;
+    };
+
+    iterator begin() const {
+        return iterator(jni::env(), list_.object().getHandle(), 0, size_);
+    }
+    iterator end() const {
+        return iterator(nullptr, list_.object().getHandle(), size_, size_);
+    }
+
+    /*!
+     * Number of elements in the list.
+     */
+    std::size_t size() const noexcept { return std::size_t(size_); }
+
+  private:
+    java::util::List list_;
+    int32_t size_;
+};
+
+/*!
+ * Copy the elements of @p list into a vector, converted to @p T.
+ *
+ * Uses a single `List.toArray()` call and a batched array read, rather than
+ * one `List.get()` call per element. Each element holds its own global
+ * reference, so the result outlives the list.
+ */
+template <typename T = jni::Object>
+std::vector<T> toVector(java::util::List const &list) {
+    auto array =
+        java::util::List::Meta::data().toArray.call(list.object()).toVector();
+    std::vector<T> result;
+    result.reserve(array.size());
+    for (auto &element : array) {
+        result.emplace_back(std::move(element));
+    }
+    return result;
+}
+} // namespace wrap
@@ -0,0 +1,160 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "MappedFile.h"
+#include "NativeFdHandle.h"
+
+#include <jnipp.h>
+
+#include <cassert>
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace wrap {
+namespace {
+/*!
+ * Classes and method IDs used on java.nio buffers.
+ */
+struct BufferMethods {
+    BufferMethods()
+        : byteBuffer("java/nio/ByteBuffer"),
+          mappedByteBuffer("java/nio/MappedByteBuffer"),
+          asReadOnlyBuffer(byteBuffer.getMethod("asReadOnlyBuffer",
+                                                "()Ljava/nio/ByteBuffer;")),
+          isReadOnly(byteBuffer.getMethod("isReadOnly", "()Z")),
+          force(mappedByteBuffer.getMethod("force",
+                                           "()Ljava/nio/MappedByteBuffer;")) {}
+
+    jni::Class byteBuffer;
+    jni::Class mappedByteBuffer;
+    jni::method_t asReadOnlyBuffer;
+    jni::method_t isReadOnly;
+    jni::method_t force;
+};
+
+BufferMethods const &bufferMethods() {
+    static const BufferMethods methods;
+    return methods;
+}
+
+[[noreturn]] void throwErrno(const char *what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+} // namespace
+
+MappedFile MappedFile::map(java::io::File &file, Access access,
+                           std::size_t size) {
+    bool writable = access == Access::ReadWrite;
+    assert(writable || size == 0);
+    std::string path = file.getAbsolutePath();
+    int flags = writable ? O_RDWR | O_CREAT : O_RDONLY;
+    NativeFdHandle fd(::open(path.c_str(), flags | O_CLOEXEC, 0644));
+    if (!fd.valid()) {
+        throwErrno("open");
+    }
+    if (size != 0) {
+        if (::ftruncate(fd.get(), off_t(size)) != 0) {
+            throwErrno("ftruncate");
+        }
+    } else {
+        size = std::size_t(fd.fileSize());
+    }
+    int protection = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+    void *data = ::mmap(nullptr, size, protection, MAP_SHARED, fd.get(), 0);
+    if (data == MAP_FAILED) {
+        throwErrno("mmap");
+    }
+    // The mapping keeps the file open: the descriptor is no longer needed.
+    MappedFile result;
+    result.data_ = static_cast<uint8_t *>(data);
+    result.size_ = size;
+    result.writable_ = writable;
+    result.owned_ = true;
+    return result;
+}
+
+MappedFile MappedFile::fromByteBuffer(jni::Object const &buffer) {
+    JNIEnv *env = jni::env();
+    void *data = env->GetDirectBufferAddress(buffer.getHandle());
+    if (data == nullptr) {
+        throw std::invalid_argument("Not a direct ByteBuffer");
+    }
+    jlong capacity = env->GetDirectBufferCapacity(buffer.getHandle());
+    MappedFile result;
+    result.data_ = static_cast<uint8_t *>(data);
+    result.size_ = std::size_t(capacity);
+    result.writable_ = !buffer.call<bool>(bufferMethods().isReadOnly);
+    // Take a global reference of our own, keeping the Java mapping alive.
+    result.buffer_ = jni::Object(buffer.getHandle());
+    return result;
+}
+
+MappedFile::~MappedFile() { reset(); }
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      writable_(std::exchange(other.writable_, false)),
+      owned_(std::exchange(other.owned_, false)),
+      buffer_(std::move(other.buffer_)) {}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+        reset();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        writable_ = std::exchange(other.writable_, false);
+        owned_ = std::exchange(other.owned_, false);
+        buffer_ = std::move(other.buffer_);
+    }
+    return *this;
+}
+
+jni::Object const &MappedFile::byteBuffer() {
+    if (buffer_.isNull()) {
+        assert(data_ != nullptr);
+        JNIEnv *env = jni::env();
+        jobject buffer = env->NewDirectByteBuffer(data_, jlong(size_));
+        if (buffer == nullptr) {
+            jni::internal::checkJavaExceptions();
+        }
+        jni::Object direct(buffer, jni::Object::DeleteLocalInput);
+        // Writes through a buffer over read-only pages would crash.
+        buffer_ = writable_ ? std::move(direct)
+                            : direct.call<jni::Object>(
+                                  bufferMethods().asReadOnlyBuffer);
+    }
+    return buffer_;
+}
+
+void MappedFile::sync() {
+    if (owned_) {
+        if (::msync(data_, size_, MS_SYNC) != 0) {
+            throwErrno("msync");
+        }
+    } else if (!buffer_.isNull() &&
+               jni::env()->IsInstanceOf(
+                   buffer_.getHandle(),
+                   bufferMethods().mappedByteBuffer.getHandle())) {
+        buffer_.call<jni::Object>(bufferMethods().force);
+    }
+}
+
+void MappedFile::reset() noexcept {
+    if (owned_ && data_ != nullptr) {
+        ::munmap(data_, size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+    writable_ = false;
+    owned_ = false;
+    // Assignment may throw: release through a local's destructor instead.
+    jni::Object released(std::move(buffer_));
+}
+} // namespace wrap
@@ -0,0 +1,93 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "java.io.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace wrap {
+/*!
+ * A memory-mapped file shared by C++ and Java without copying.
+ *
+ * Either map a file natively with map() and give Java a direct ByteBuffer
+ * over the same pages with byteBuffer(), or take a direct ByteBuffer that
+ * Java mapped (typically with FileChannel.map()) with fromByteBuffer() and
+ * access its memory natively.
+ *
+ * Lifetime: a MappedFile from fromByteBuffer() holds a global reference to
+ * the buffer, so the Java mapping outlives the native view. The reverse is
+ * not possible: Java has no way to learn that native memory went away, so
+ * the buffer from byteBuffer() must no longer be used once its MappedFile is
+ * destroyed.
+ */
+class MappedFile {
+  public:
+    enum class Access { ReadOnly, ReadWrite };
+
+    MappedFile() = default;
+
+    /*!
+     * Map @p file, which must not end up empty.
+     *
+     * With Access::ReadWrite, the file is created if needed and, if @p size
+     * is not zero, resized to @p size bytes first. Otherwise, @p size must be
+     * zero and the whole file is mapped.
+     *
+     * Failed system calls throw std::system_error.
+     */
+    static MappedFile map(java::io::File &file,
+                          Access access = Access::ReadOnly,
+                          std::size_t size = 0);
+
+    /*!
+     * View the memory of the direct ByteBuffer @p buffer, which is writable
+     * unless the buffer is read-only.
+     *
+     * Throws std::invalid_argument if @p buffer is not a direct buffer.
+     */
+    static MappedFile fromByteBuffer(jni::Object const &buffer);
+
+    ~MappedFile();
+
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+    MappedFile(MappedFile const &) = delete;
+    MappedFile &operator=(MappedFile const &) = delete;
+
+    /*!
+     * The mapped bytes, which may only be modified if writable().
+     */
+    uint8_t *data() const noexcept { return data_; }
+
+    std::size_t size() const noexcept { return size_; }
+
+    bool writable() const noexcept { return writable_; }
+
+    /*!
+     * A direct ByteBuffer over the mapped bytes, read-only unless writable().
+     *
+     * Created on first use; later calls return the same buffer.
+     */
+    jni::Object const &byteBuffer();
+
+    /*!
+     * Write modified pages back to the file and wait for completion: msync()
+     * for native mappings, MappedByteBuffer.force() for Java ones. Does
+     * nothing for a buffer that is not backed by a file.
+     */
+    void sync();
+
+  private:
+    void reset() noexcept;
+
+    uint8_t *data_ = nullptr;
+    std::size_t size_ = 0;
+    bool writable_ = false;
+    //! Whether data_ was mapped by us, and must be unmapped.
+    bool owned_ = false;
+    jni::Object buffer_;
+};
+} // namespace wrap
@@ -0,0 +1,186 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "NativeFdHandle.h"
+
+#include <cassert>
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace wrap {
+namespace {
+[[noreturn]] void throwErrno(const char *what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+} // namespace
+
+MappedView::~MappedView() { reset(); }
+
+MappedView::MappedView(MappedView &&other) noexcept
+    : base_(std::exchange(other.base_, nullptr)),
+      skew_(std::exchange(other.skew_, 0)),
+      size_(std::exchange(other.size_, 0)) {}
+
+MappedView &MappedView::operator=(MappedView &&other) noexcept {
+    if (this != &other) {
+        reset();
+        base_ = std::exchange(other.base_, nullptr);
+        skew_ = std::exchange(other.skew_, 0);
+        size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+}
+
+void MappedView::reset() noexcept {
+    if (base_ != nullptr) {
+        ::munmap(base_, skew_ + size_);
+        base_ = nullptr;
+    }
+    skew_ = 0;
+    size_ = 0;
+}
+
+NativeFdHandle
+NativeFdHandle::detach(android::os::ParcelFileDescriptor &pfd) {
+    return NativeFdHandle(pfd.detachFd());
+}
+
+NativeFdHandle NativeFdHandle::dup(android::os::ParcelFileDescriptor &pfd) {
+    int fd = ::fcntl(pfd.getFd(), F_DUPFD_CLOEXEC, 0);
+    if (fd < 0) {
+        throwErrno("fcntl(F_DUPFD_CLOEXEC)");
+    }
+    return NativeFdHandle(fd);
+}
+
+NativeFdHandle::~NativeFdHandle() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+NativeFdHandle::NativeFdHandle(NativeFdHandle &&other) noexcept
+    : fd_(other.release()) {}
+
+NativeFdHandle &NativeFdHandle::operator=(NativeFdHandle &&other) noexcept {
+    if (this != &other) {
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+        fd_ = other.release();
+    }
+    return *this;
+}
+
+int NativeFdHandle::release() noexcept { return std::exchange(fd_, -1); }
+
+android::os::ParcelFileDescriptor NativeFdHandle::toParcelFileDescriptor() {
+    assert(valid());
+    auto pfd = android::os::ParcelFileDescriptor::adoptFd(fd_);
+    // Only give up the descriptor once Java has actually taken it.
+    release();
+    return pfd;
+}
+
+void NativeFdHandle::close() {
+    // The descriptor is gone even if close() fails, so never retry it.
+    int fd = release();
+    if (fd >= 0 && ::close(fd) != 0 && errno != EINTR) {
+        throwErrno("close");
+    }
+}
+
+int64_t NativeFdHandle::fileSize() const {
+    struct stat info {};
+    if (::fstat(fd_, &info) != 0) {
+        throwErrno("fstat");
+    }
+    return int64_t(info.st_size);
+}
+
+std::size_t NativeFdHandle::pread(void *dest, std::size_t size,
+                                  int64_t offset) const {
+    for (;;) {
+        ssize_t count = ::pread(fd_, dest, size, off_t(offset));
+        if (count >= 0) {
+            return std::size_t(count);
+        }
+        if (errno != EINTR) {
+            throwErrno("pread");
+        }
+    }
+}
+
+std::size_t NativeFdHandle::writev(const iovec *iov, int count) const {
+    // Partial writes modify the list, so work on a copy.
+    std::vector<iovec> pending(iov, iov + count);
+    iovec *next = pending.data();
+    int remaining = count;
+    std::size_t total = 0;
+    for (;;) {
+        // Skip empty buffers, so that writing nothing below means no progress.
+        while (remaining > 0 && next->iov_len == 0) {
+            ++next;
+            --remaining;
+        }
+        if (remaining == 0) {
+            break;
+        }
+        ssize_t written = ::writev(fd_, next, remaining);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throwErrno("writev");
+        }
+        if (written == 0) {
+            throw std::system_error(std::make_error_code(std::errc::io_error),
+                                    "writev wrote nothing");
+        }
+        total += std::size_t(written);
+        auto left = std::size_t(written);
+        while (remaining > 0 && left >= next->iov_len) {
+            left -= next->iov_len;
+            ++next;
+            --remaining;
+        }
+        if (remaining > 0) {
+            next->iov_base = static_cast<char *>(next->iov_base) + left;
+            next->iov_len -= left;
+        }
+    }
+    return total;
+}
+
+MappedView NativeFdHandle::map(int64_t offset, std::size_t length) const {
+    if (offset < 0) {
+        throw std::invalid_argument("NativeFdHandle::map: negative offset");
+    }
+    if (length == 0) {
+        int64_t size = fileSize();
+        if (offset >= size) {
+            return MappedView{};
+        }
+        length = std::size_t(size - offset);
+    }
+    // mmap wants a page-aligned offset: map from the page start and skip.
+    auto pageSize = int64_t(::sysconf(_SC_PAGESIZE));
+    int64_t aligned = offset - offset % pageSize;
+    auto skew = std::size_t(offset - aligned);
+    void *base = ::mmap(nullptr, skew + length, PROT_READ, MAP_SHARED, fd_,
+                        off_t(aligned));
+    if (base == MAP_FAILED) {
+        throwErrno("mmap");
+    }
+    return MappedView(base, skew, length);
+}
+} // namespace wrap
@@ -0,0 +1,141 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "android.os.h"
+
+#include <cstddef>
+#include <cstdint>
+
+struct iovec;
+
+namespace wrap {
+/*!
+ * Read-only memory mapping of (part of) a file, unmapped on destruction.
+ */
+class MappedView {
+  public:
+    MappedView() = default;
+    ~MappedView();
+
+    MappedView(MappedView &&other) noexcept;
+    MappedView &operator=(MappedView &&other) noexcept;
+    MappedView(MappedView const &) = delete;
+    MappedView &operator=(MappedView const &) = delete;
+
+    /*!
+     * The first mapped byte, at the offset requested from NativeFdHandle::map.
+     */
+    const uint8_t *data() const noexcept {
+        return static_cast<const uint8_t *>(base_) + skew_;
+    }
+
+    std::size_t size() const noexcept { return size_; }
+
+    bool empty() const noexcept { return size_ == 0; }
+
+  private:
+    friend class NativeFdHandle;
+    MappedView(void *base, std::size_t skew, std::size_t size) noexcept
+        : base_(base), skew_(skew), size_(size) {}
+    void reset() noexcept;
+
+    void *base_ = nullptr;
+    //! Distance from the page-aligned mapping start to the requested offset.
+    std::size_t skew_ = 0;
+    std::size_t size_ = 0;
+};
+
+/*!
+ * Owner of a native file descriptor taken from a ParcelFileDescriptor, for
+ * doing I/O directly from C++ without moving bytes through the JVM.
+ *
+ * The descriptor is closed on destruction. Failed system calls throw
+ * std::system_error.
+ */
+class NativeFdHandle {
+  public:
+    NativeFdHandle() = default;
+
+    /*!
+     * Take ownership of @p fd.
+     */
+    explicit NativeFdHandle(int fd) noexcept : fd_(fd) {}
+
+    /*!
+     * Take the descriptor away from @p pfd with detachFd().
+     *
+     * Afterwards @p pfd no longer owns a descriptor and closing it is a
+     * no-op: this handle is the only owner.
+     */
+    static NativeFdHandle detach(android::os::ParcelFileDescriptor &pfd);
+
+    /*!
+     * Duplicate the descriptor of @p pfd, which keeps its own: both sides
+     * must then be closed independently.
+     */
+    static NativeFdHandle dup(android::os::ParcelFileDescriptor &pfd);
+
+    ~NativeFdHandle();
+
+    NativeFdHandle(NativeFdHandle &&other) noexcept;
+    NativeFdHandle &operator=(NativeFdHandle &&other) noexcept;
+    NativeFdHandle(NativeFdHandle const &) = delete;
+    NativeFdHandle &operator=(NativeFdHandle const &) = delete;
+
+    bool valid() const noexcept { return fd_ >= 0; }
+
+    int get() const noexcept { return fd_; }
+
+    /*!
+     * Give up ownership of the descriptor without closing it.
+     */
+    int release() noexcept;
+
+    /*!
+     * Hand the descriptor back to Java with ParcelFileDescriptor.adoptFd(),
+     * leaving this handle empty.
+     */
+    android::os::ParcelFileDescriptor toParcelFileDescriptor();
+
+    /*!
+     * Close the descriptor now, reporting errors that the destructor would
+     * have to ignore.
+     */
+    void close();
+
+    /*!
+     * Size of the file, from fstat().
+     */
+    int64_t fileSize() const;
+
+    /*!
+     * Read up to @p size bytes at @p offset without moving the file offset.
+     *
+     * @return the number of bytes read, 0 at the end of the file.
+     */
+    std::size_t pread(void *dest, std::size_t size, int64_t offset) const;
+
+    /*!
+     * Write all of the @p count buffers in @p iov, in order, at the current
+     * file offset, retrying after partial writes. A write that makes no
+     * progress throws, rather than retrying forever.
+     *
+     * @return the total number of bytes written.
+     */
+    std::size_t writev(const iovec *iov, int count) const;
+
+    /*!
+     * Map @p length bytes starting at @p offset read-only. A @p length of 0
+     * maps everything from @p offset to the end of the file, which gives an
+     * empty view at or past the end.
+     *
+     * @throws std::invalid_argument if @p offset is negative.
+     */
+    MappedView map(int64_t offset = 0, std::size_t length = 0) const;
+
+  private:
+    int fd_ = -1;
+};
+} // namespace wrap
@@ -4,8 +4,13 @@
 
 #pragma once
 #include <assert.h>
+#include <atomic>
+#include <cstdint>
 #include <jni.h>
 #include <jnipp.h>
+#include <mutex>
+#include <string>
+#include <type_traits>
 
 namespace wrap {
 
@@ -15,7 +20,7 @@ namespace wrap {
  * Derived types are encouraged to have a nested `struct Meta`, inheriting
  * publicly from MetaBaseDroppable or MetaBase, with a singleton accessor named
  * `data()`, and a private constructor (implemented in a .cpp file, not the
- * header) that populates jni::method_t, jni::field_t, etc. members for each
+ * header) that populates impl::MethodId, impl::FieldId, etc. members for each
  * method, etc. of interest.
  */
 class ObjectWrapperBase {
@@ -45,6 +50,23 @@ class ObjectWrapperBase {
      */
     bool isNull() const noexcept { return obj_.isNull(); }
 
+    /*!
+     * Is the underlying handle null?
+     *
+     * A pure pointer check that never calls into the JVM: it does not detect
+     * a cleared weak reference. Prefer isNull() unless you know the wrapped
+     * reference is strong.
+     */
+    bool isNullHandle() const noexcept { return obj_.isNullHandle(); }
+
+    /*!
+     * Switch the wrapped jni::Object to shared mode.
+     *
+     * Copies of this wrapper made afterwards share one global reference, and
+     * cost an atomic increment rather than a NewGlobalRef call.
+     */
+    void shareReference() { obj_ = obj_.makeShared(); }
+
     /*!
      * Get the wrapped jni::Object
      */
@@ -107,6 +129,125 @@ static inline bool operator!=(std::nullptr_t,
     return !(obj == nullptr);
 }
 
+/*!
+ * Compact storage for a wrapped Java object.
+ *
+ * ObjectWrapperBase holds a full jni::Object, which is several words wide and
+ * polymorphic. This instead holds a single jni::Ref (one pointer, always a
+ * global reference), so it is the better choice for containers holding many
+ * wrapped objects. Use get() to obtain a wrapper borrowing the reference when
+ * you need to call into Java.
+ *
+ * @tparam T A type derived from ObjectWrapperBase.
+ */
+template <typename T> class Compact {
+  public:
+    /*!
+     * Default constructor: null.
+     */
+    Compact() = default;
+
+    /*!
+     * Construct from a wrapper, adding a global reference to its object.
+     */
+    explicit Compact(T const &wrapper) : ref_(wrapper.object()) {}
+
+    /*!
+     * Construct from a wrapper, taking over its global reference if any.
+     */
+    explicit Compact(T &&wrapper) : ref_(std::move(wrapper.object())) {}
+
+    /*!
+     * Is this object null?
+     */
+    bool isNull() const noexcept { return ref_.isNull(); }
+
+    /*!
+     * Evaluate if this is non-null
+     */
+    explicit operator bool() const noexcept { return !ref_.isNull(); }
+
+    /*!
+     * Get a wrapper that borrows this reference.
+     *
+     * The returned wrapper must not outlive this object: use toWrapper() if it
+     * needs to.
+     */
+    T get() const { return T{ref_.borrow()}; }
+
+    /*!
+     * Get a wrapper holding its own global reference.
+     */
+    T toWrapper() const { return T{ref_.toObject()}; }
+
+    /*!
+     * Get the underlying jni::Ref
+     */
+    jni::Ref const &ref() const noexcept { return ref_; }
+
+  private:
+    jni::Ref ref_;
+};
+
+static_assert(sizeof(Compact<ObjectWrapperBase>) == sizeof(void *),
+              "Compact must stay a single pointer wide");
+
+/*!
+ * Weak reference to a wrapped Java object.
+ *
+ * Holds a jni::WeakObject, so it does not keep the Java object alive: useful
+ * for caching listeners, views, contexts and the like.
+ *
+ * @tparam T A type derived from ObjectWrapperBase.
+ */
+template <typename T> class Weak {
+  public:
+    /*!
+     * Default constructor: null.
+     */
+    Weak() = default;
+
+    /*!
+     * Construct from a wrapper, creating a weak reference to its object.
+     */
+    explicit Weak(T const &wrapper) : weak_(wrapper.object()) {}
+
+    /*!
+     * Has the Java object been garbage collected (or was this null)?
+     */
+    bool expired() const noexcept { return weak_.expired(); }
+
+    /*!
+     * Get a wrapper holding a strong reference, or a null wrapper if the Java
+     * object has been collected.
+     */
+    T lock() const { return T{weak_.lock()}; }
+
+    /*!
+     * Get the underlying jni::WeakObject
+     */
+    jni::WeakObject const &weakObject() const noexcept { return weak_; }
+
+  private:
+    jni::WeakObject weak_;
+};
+
+/*!
+ * Equality comparison for weakly-referenced wrapped Java objects.
+ */
+template <typename T>
+static inline bool operator==(Weak<T> const &lhs, Weak<T> const &rhs) {
+    return lhs.weakObject() == rhs.weakObject();
+}
+
+/*!
+ * Inequality comparison for weakly-referenced wrapped Java objects.
+ */
+template <typename T>
+static inline bool operator!=(Weak<T> const &lhs, Weak<T> const &rhs) {
+    return !(lhs == rhs);
+}
+
 /*!
  * Base class for Meta structs where you want the reference to the Class object
  * to persist (indefinitely).
@@ -168,14 +309,15 @@ class MetaBase {
 class MetaBaseDroppable {
   public:
     /*!
-     * Gets the class object.
+     * Gets a reference to the class object.
      *
-     * Works regardless of whether dropClassRef() has been called - it's just
-     * slower if it has.
+     * Works regardless of whether dropClassRef() has been called: if it has,
+     * the first call looks the class up again and caches it from then on, so
+     * only classes whose static members are actually used keep a reference.
      */
-    jni::Class clazz() const {
-        if (clazz_.isNull()) {
-            return {classname_};
+    jni::Class const &clazz() const {
+        if (!cached_.load(std::memory_order_acquire)) {
+            recacheClassRef();
         }
         return clazz_;
     }
@@ -188,8 +330,15 @@ class MetaBaseDroppable {
     /*!
      * May be called in/after the derived constructor, to drop the reference to
      * the class object if it's no longer needed.
+     *
+     * Invalidates references previously returned by clazz(), so must not be
+     * called while other threads may be using them.
      */
-    void dropClassRef() { clazz_ = jni::Class{}; }
+    void dropClassRef() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cached_.store(false, std::memory_order_release);
+        clazz_ = jni::Class{};
+    }
 
   protected:
     /*!
@@ -205,7 +354,7 @@ class MetaBaseDroppable {
      */
     explicit MetaBaseDroppable(const char *classname,
                                jni::jclass clazz = nullptr)
-        : classname_(classname), clazz_() {
+        : classname_(classname), clazz_(), cached_(true) {
         if (clazz != nullptr) {
             // The 0 makes it a global ref.
             clazz_ = jni::Class{clazz, 0};
@@ -224,8 +373,21 @@ class MetaBaseDroppable {
     jni::Class const &classRef() const { return clazz_; }
 
   private:
+    /*!
+     * Slow path of clazz(): look up the class again after a drop.
+     */
+    void recacheClassRef() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!cached_.load(std::memory_order_relaxed)) {
+            clazz_ = jni::Class{classname_};
+            cached_.store(true, std::memory_order_release);
+        }
+    }
+
     const char *classname_;
-    jni::Class clazz_;
+    mutable jni::Class clazz_;
+    mutable std::atomic<bool> cached_;
+    mutable std::mutex mutex_;
 };
 
 /*!
@@ -333,5 +495,203 @@ static inline T get(WrappedFieldId<T> const &field, jni::Object const &obj) {
     assert(!obj.isNull());
     return T{obj.get<jni::Object>(field.id)};
 }
+
+/*!
+ * Skip over one type in a JNI signature.
+ */
+static inline bool skipSignatureType(const char *&sig) noexcept {
+    while (*sig == '[') {
+        ++sig;
+    }
+    if (*sig == 'L') {
+        while (*sig != '\0' && *sig != ';') {
+            ++sig;
+        }
+    }
+    if (*sig == '\0') {
+        return false;
+    }
+    ++sig;
+    return true;
+}
+
+/*!
+ * Describes how the C++ type @p T, as used with jnipp, may appear in a JNI
+ * signature.
+ *
+ * `matches()` consumes one type from the signature and reports whether it is
+ * compatible with @p T.
+ */
+template <typename T, typename = void> struct SignatureType;
+
+/*!
+ * Primitive types (and void): a single letter.
+ */
+template <typename T>
+struct SignatureType<T, std::enable_if_t<std::is_arithmetic<T>::value ||
+                                         std::is_void<T>::value>> {
+    static constexpr char letter() noexcept {
+        if constexpr (std::is_void<T>::value) {
+            return 'V';
+        } else if constexpr (std::is_same<T, bool>::value) {
+            return 'Z';
+        } else if constexpr (std::is_floating_point<T>::value) {
+            return sizeof(T) == 4 ? 'F' : 'D';
+        } else if constexpr (std::is_same<T, wchar_t>::value ||
+                             std::is_same<T, uint16_t>::value) {
+            return 'C';
+        } else {
+            switch (sizeof(T)) {
+            case 1:
+                return 'B';
+            case 2:
+                return 'S';
+            case 4:
+                return 'I';
+            default:
+                return 'J';
+            }
+        }
+    }
+    static bool matches(const char *&sig) noexcept {
+        return *sig++ == letter();
+    }
+};
+
+/*!
+ * Strings: only java.lang.String.
+ */
+template <> struct SignatureType<std::string> {
+    static bool matches(const char *&sig) noexcept {
+        static constexpr char name[] = "Ljava/lang/String;";
+        if (std::strncmp(sig, name, sizeof(name) - 1) != 0) {
+            return false;
+        }
+        sig += sizeof(name) - 1;
+        return true;
+    }
+};
+
+/*!
+ * Untyped objects: any reference type, including arrays.
+ */
+template <> struct SignatureType<jni::Object> {
+    static bool matches(const char *&sig) noexcept {
+        return (*sig == 'L' || *sig == '[') && skipSignatureType(sig);
+    }
+};
+
+/*!
+ * Arrays: checked element-wise.
+ */
+template <typename T> struct SignatureType<jni::Array<T>> {
+    static bool matches(const char *&sig) noexcept {
+        return *sig++ == '[' && SignatureType<T>::matches(sig);
+    }
+};
+
+/*!
+ * Check that a JNI method signature is compatible with the C++ prototype
+ * `R(Args...)`.
+ */
+template <typename R, typename... Args>
+static inline bool signatureMatches(const char *sig) noexcept {
+    if (*sig++ != '(') {
+        return false;
+    }
+    bool paramsMatch = (SignatureType<Args>::matches(sig) && ...);
+    if (!paramsMatch || *sig++ != ')') {
+        return false;
+    }
+    return SignatureType<R>::matches(sig) && *sig == '\0';
+}
+
+/*!
+ * Helper for method ID lookup: validates the signature against the C++
+ * prototype before looking up the ID.
+ */
+template <typename R, typename... Args>
+static inline jni::method_t lookupMethod(jni::Class const &clazz,
+                                         const char *name,
+                                         const char *signature,
+                                         bool isStatic) {
+    if (!signatureMatches<R, Args...>(signature)) {
+        throw jni::NameResolutionException(
+            (std::string(name) + signature).c_str());
+    }
+    return isStatic ? clazz.getStaticMethod(name, signature)
+                    : clazz.getMethod(name, signature);
+}
+
+/*!
+ * Type-aware wrapper for a method ID.
+ *
+ * This is a smarter alternative to just using jni::method_t since the C++
+ * prototype is part of the type: it is checked against the JNI signature when
+ * the ID is looked up, and arguments are converted to exactly the declared
+ * types when called, without using any more storage.
+ *
+ * @tparam Signature A function type `R(Args...)`, using the types understood
+ * by jnipp.
+ *
+ * @see StaticMethodId for the equivalent for static methods.
+ */
+template <typename Signature> struct MethodId;
+
+template <typename R, typename... Args> struct MethodId<R(Args...)> {
+  public:
+    MethodId(jni::Class const &clazz, const char *name, const char *signature)
+        : id(lookupMethod<R, Args...>(clazz, name, signature, false)) {}
+
+    /*!
+     * Call this method on Java object @p obj.
+     *
+     * jnipp converts @p args in place into an array on the stack and picks
+     * the `Call<Type>MethodA` function from @p R at compile time, so this
+     * costs no more than calling JNI directly.
+     */
+    R call(jni::Object const &obj, Args const &...args) const {
+        return obj.call<R>(id, args...);
+    }
+
+    /*!
+     * Record a call of this method on Java object @p obj in @p batch, to be
+     * run by jni::CallBatch::execute(). Only void methods can be batched.
+     */
+    jni::CallBatch &addTo(jni::CallBatch &batch, jni::Object const &obj,
+                          Args const &...args) const {
+        static_assert(std::is_void<R>::value,
+                      "Only void methods can be added to a CallBatch");
+        return batch.add(obj, id, args...);
+    }
+
+    const jni::method_t id;
+};
+
+/*!
+ * Type-aware wrapper for a static method ID.
+ *
+ * @see MethodId
+ */
+template <typename Signature> struct StaticMethodId;
+
+template <typename R, typename... Args> struct StaticMethodId<R(Args...)> {
+  public:
+    StaticMethodId(jni::Class const &clazz, const char *name,
+                   const char *signature)
+        : id(lookupMethod<R, Args...>(clazz, name, signature, true)) {}
+
+    /*!
+     * Call this static method on Java type @p clazz.
+     *
+     * @see MethodId::call()
+     */
+    R call(jni::Class const &clazz, Args const &...args) const {
+        assert(!clazz.isNull());
+        return clazz.call<R>(id, args...);
+    }
+
+    const jni::method_t id;
+};
 } // namespace impl
 } // namespace wrap
@@ -0,0 +1,73 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "OutputStreamSink.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace wrap {
+OutputStreamSink::OutputStreamSink(java::io::OutputStream stream,
+                                   std::size_t chunkSize)
+    : stream_(std::move(stream)), chunkSize_(chunkSize),
+      array_(long(chunkSize)) {
+    assert(chunkSize > 0);
+    buffer_.reserve(chunkSize);
+}
+
+OutputStreamSink::~OutputStreamSink() {
+    try {
+        drain();
+    } catch (...) {
+        // Nothing sensible to do in a destructor: callers who care flush().
+    }
+}
+
+void OutputStreamSink::write(const void *data, std::size_t size) {
+    auto bytes = static_cast<const jni::byte_t *>(data);
+    std::size_t chunkSize = chunkSize_;
+
+    // Top up a partially filled buffer first, to keep the output in order.
+    if (!buffer_.empty()) {
+        std::size_t count = std::min(size, chunkSize - buffer_.size());
+        buffer_.insert(buffer_.end(), bytes, bytes + count);
+        bytes += count;
+        size -= count;
+        if (buffer_.size() < chunkSize) {
+            return;
+        }
+        drain();
+    }
+
+    // Whole chunks go straight from the caller's memory.
+    while (size >= chunkSize) {
+        writeChunk(bytes, chunkSize);
+        bytes += chunkSize;
+        size -= chunkSize;
+    }
+    buffer_.insert(buffer_.end(), bytes, bytes + size);
+}
+
+void OutputStreamSink::flush() {
+    drain();
+    stream_.flush();
+}
+
+void OutputStreamSink::close() {
+    drain();
+    stream_.close();
+}
+
+void OutputStreamSink::writeChunk(const jni::byte_t *data, std::size_t size) {
+    array_.setRegion(0, long(size), data);
+    java::io::OutputStream::Meta::data().write2.call(
+        stream_.object(), array_, 0, int32_t(size));
+}
+
+void OutputStreamSink::drain() {
+    if (!buffer_.empty()) {
+        writeChunk(buffer_.data(), buffer_.size());
+        buffer_.clear();
+    }
+}
+} // namespace wrap
@@ -0,0 +1,64 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "java.io.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace wrap {
+/*!
+ * Buffered sink writing bytes from C++ to any java.io.OutputStream.
+ *
+ * Writes are collected in a native buffer and handed to Java in chunks of
+ * `chunkSize` bytes, each with one array region copy and one call to
+ * `write(byte[], int, int)`. The same Java byte array is reused for every
+ * chunk. Writes at least as large as a chunk skip the native buffer.
+ *
+ * Call flush() or close() to make sure everything has been written: the
+ * destructor makes a last attempt, but cannot report failure.
+ */
+class OutputStreamSink {
+  public:
+    /*!
+     * Wrap @p stream, buffering up to @p chunkSize bytes, which must not be
+     * zero.
+     */
+    explicit OutputStreamSink(java::io::OutputStream stream,
+                              std::size_t chunkSize = 64 * 1024);
+
+    /*!
+     * Write any buffered bytes, ignoring errors. Does not close the stream.
+     */
+    ~OutputStreamSink();
+
+    OutputStreamSink(OutputStreamSink const &) = delete;
+    OutputStreamSink &operator=(OutputStreamSink const &) = delete;
+
+    /*!
+     * Write @p size bytes from @p data.
+     */
+    void write(const void *data, std::size_t size);
+
+    /*!
+     * Write all buffered bytes, then flush the Java stream.
+     */
+    void flush();
+
+    /*!
+     * Write all buffered bytes, then close the Java stream.
+     */
+    void close();
+
+  private:
+    void writeChunk(const jni::byte_t *data, std::size_t size);
+    void drain();
+
+    java::io::OutputStream stream_;
+    std::size_t chunkSize_;
+    jni::Array<jni::byte_t> array_;
+    std::vector<jni::byte_t> buffer_;
+};
+} // namespace wrap
@@ -0,0 +1,89 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "PixelBufferPool.h"
+
+#include <jnipp.h>
+
+#include <cassert>
+#include <cstring>
+
+namespace wrap {
+namespace {
+jni::method_t rewindMethod() {
+    static const jni::method_t rewind = jni::Class("java/nio/Buffer")
+                                            .getMethod("rewind",
+                                                       "()Ljava/nio/Buffer;");
+    return rewind;
+}
+} // namespace
+
+PixelBuffer::PixelBuffer(std::size_t rowBytes, std::size_t height)
+    : rowBytes_(rowBytes), height_(height),
+      storage_(new uint8_t[rowBytes * height]) {
+    assert(size() > 0);
+    JNIEnv *env = jni::env();
+    jobject buffer = env->NewDirectByteBuffer(storage_.get(), jlong(size()));
+    if (buffer == nullptr) {
+        jni::internal::checkJavaExceptions();
+    }
+    buffer_ = jni::Object(buffer, jni::Object::DeleteLocalInput);
+}
+
+jni::Object &PixelBuffer::rewoundByteBuffer() {
+    // copyPixels{To,From}Buffer advance the position: reset it for reuse.
+    buffer_.call<jni::Object>(rewindMethod());
+    return buffer_;
+}
+
+void PixelBufferPool::Return::operator()(PixelBuffer *buffer) const noexcept {
+    pool->recycle(buffer);
+}
+
+PixelBufferPool::Lease PixelBufferPool::acquire(std::size_t rowBytes,
+                                                std::size_t height) {
+    auto &idle = idle_[Layout{rowBytes, height}];
+    if (!idle.empty()) {
+        Lease lease(idle.back().release(), Return{this});
+        idle.pop_back();
+        return lease;
+    }
+    // Make room for the buffer's return now: recycle() must not allocate.
+    idle.reserve(maxIdlePerLayout_);
+    return Lease(new PixelBuffer(rowBytes, height), Return{this});
+}
+
+PixelBufferPool::Lease
+PixelBufferPool::acquire(android::graphics::Bitmap &bitmap) {
+    return acquire(std::size_t(bitmap.getRowBytes()),
+                   std::size_t(bitmap.getHeight()));
+}
+
+void PixelBufferPool::upload(android::graphics::Bitmap &bitmap,
+                             const void *pixels) {
+    Lease buffer = acquire(bitmap);
+    std::memcpy(buffer->data(), pixels, buffer->size());
+    bitmap.copyPixelsFromBuffer(buffer->rewoundByteBuffer());
+}
+
+void PixelBufferPool::download(android::graphics::Bitmap &bitmap,
+                               void *pixels) {
+    Lease buffer = acquire(bitmap);
+    bitmap.copyPixelsToBuffer(buffer->rewoundByteBuffer());
+    std::memcpy(pixels, buffer->data(), buffer->size());
+}
+
+void PixelBufferPool::recycle(PixelBuffer *buffer) noexcept {
+    std::unique_ptr<PixelBuffer> owned(buffer);
+    // Runs in the Lease deleter: only keep the buffer if acquire() already
+    // made room for it, otherwise just free it.
+    auto it = idle_.find(Layout{buffer->rowBytes(), buffer->height()});
+    if (it == idle_.end()) {
+        return;
+    }
+    auto &idle = it->second;
+    if (idle.size() < maxIdlePerLayout_ && idle.size() < idle.capacity()) {
+        idle.push_back(std::move(owned));
+    }
+}
+} // namespace wrap
@@ -0,0 +1,115 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "android.graphics.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace wrap {
+/*!
+ * Native pixel memory, also visible to Java as a direct ByteBuffer.
+ */
+class PixelBuffer {
+  public:
+    /*!
+     * Allocate @p height rows of @p rowBytes bytes each.
+     */
+    PixelBuffer(std::size_t rowBytes, std::size_t height);
+
+    PixelBuffer(PixelBuffer const &) = delete;
+    PixelBuffer &operator=(PixelBuffer const &) = delete;
+
+    uint8_t *data() noexcept { return storage_.get(); }
+    const uint8_t *data() const noexcept { return storage_.get(); }
+
+    std::size_t rowBytes() const noexcept { return rowBytes_; }
+    std::size_t height() const noexcept { return height_; }
+    std::size_t size() const noexcept { return rowBytes_ * height_; }
+
+    /*!
+     * The direct ByteBuffer over data(), rewound to position 0.
+     */
+    jni::Object &rewoundByteBuffer();
+
+  private:
+    std::size_t rowBytes_;
+    std::size_t height_;
+    std::unique_ptr<uint8_t[]> storage_;
+    jni::Object buffer_;
+};
+
+/*!
+ * Pool of reusable PixelBuffers, keyed by bitmap layout, for moving pixels
+ * between C++ and android.graphics.Bitmap with a single memcpy and a single
+ * copyPixelsFromBuffer() or copyPixelsToBuffer() call.
+ *
+ * Buffers are matched on row stride and height, which fix their size but
+ * not the pixel format: an ARGB_8888 bitmap 100 pixels wide and an RGB_565
+ * bitmap 200 pixels wide share a buffer. That is safe because a buffer only
+ * holds raw bytes, which are always overwritten in full before use.
+ * Not thread-safe.
+ */
+class PixelBufferPool {
+  public:
+    /*!
+     * Returns a leased buffer to its pool.
+     */
+    struct Return {
+        PixelBufferPool *pool;
+        void operator()(PixelBuffer *buffer) const noexcept;
+    };
+    using Lease = std::unique_ptr<PixelBuffer, Return>;
+
+    /*!
+     * Keep at most @p maxIdlePerLayout unused buffers of each layout.
+     */
+    explicit PixelBufferPool(std::size_t maxIdlePerLayout = 2)
+        : maxIdlePerLayout_(maxIdlePerLayout) {}
+
+    PixelBufferPool(PixelBufferPool const &) = delete;
+    PixelBufferPool &operator=(PixelBufferPool const &) = delete;
+
+    /*!
+     * Lease a buffer of @p height rows of @p rowBytes bytes, reusing an idle
+     * one if possible. The pool must outlive the lease.
+     */
+    Lease acquire(std::size_t rowBytes, std::size_t height);
+
+    /*!
+     * Lease a buffer matching the layout of @p bitmap.
+     */
+    Lease acquire(android::graphics::Bitmap &bitmap);
+
+    /*!
+     * Replace the pixels of @p bitmap with the `getByteCount()` bytes at
+     * @p pixels, laid out with the bitmap's own row stride and config.
+     */
+    void upload(android::graphics::Bitmap &bitmap, const void *pixels);
+
+    /*!
+     * Copy the `getByteCount()` bytes of pixels of @p bitmap to @p pixels.
+     */
+    void download(android::graphics::Bitmap &bitmap, void *pixels);
+
+    /*!
+     * Drop all idle buffers. Buffers leased before this are freed, not
+     * pooled, when they are returned.
+     */
+    void clear() noexcept { idle_.clear(); }
+
+  private:
+    using Layout = std::pair<std::size_t, std::size_t>;
+
+    void recycle(PixelBuffer *buffer) noexcept;
+
+    std::size_t maxIdlePerLayout_;
+    std::map<Layout, std::vector<std::unique_ptr<PixelBuffer>>> idle_;
+};
+} // namespace wrap
@@ -0,0 +1,53 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Preload.h"
+
+#include <jnipp.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace wrap {
+namespace impl {
+void runPreloadTasks(std::vector<PreloadTask> const &tasks) {
+    std::atomic<size_t> next{0};
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto worker = [&] {
+        try {
+            // Attach this thread, if needed, before resolving anything.
+            jni::env();
+            for (size_t i = next++; i < tasks.size(); i = next++) {
+                tasks[i]();
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    size_t threadCount = std::min<size_t>(
+        tasks.size(), std::max(1U, std::thread::hardware_concurrency()));
+    std::vector<std::thread> threads;
+    // The calling thread is already attached: it takes a share of the work.
+    for (size_t i = 1; i < threadCount; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+} // namespace impl
+} // namespace wrap
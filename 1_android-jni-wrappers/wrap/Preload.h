@@ -0,0 +1,53 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <vector>
+
+namespace wrap {
+namespace impl {
+/*!
+ * A function that resolves the Meta struct of one wrapper.
+ */
+using PreloadTask = void (*)();
+
+/*!
+ * Resolve the Meta struct of wrapper @p T.
+ */
+template <typename T> static inline void preloadMeta() { T::Meta::data(); }
+
+/*!
+ * Run the given tasks in parallel, on worker threads attached to the JVM.
+ *
+ * Blocks until all tasks are complete. If any task throws, the first
+ * exception is rethrown here once the others have finished.
+ */
+void runPreloadTasks(std::vector<PreloadTask> const &tasks);
+} // namespace impl
+
+/*!
+ * Eagerly resolve the Meta structs (class and member IDs) of the given
+ * wrapper types, in parallel.
+ *
+ * Call this at startup, after jni::init(), to avoid the latency spike of
+ * looking up every method ID on whichever thread first uses each wrapper.
+ * Afterwards, each `Meta::data()` is just the already-initialized check of its
+ * function-local static.
+ *
+ * Worker threads attached from native code only see the system class loader,
+ * so this is suitable for framework classes, not ones loaded by the app.
+ *
+ * @tparam Classes Types derived from ObjectWrapperBase.
+ */
+template <typename... Classes> static inline void preload() {
+    impl::runPreloadTasks({&impl::preloadMeta<Classes>...});
+}
+
+/*!
+ * Eagerly resolve the Meta structs of every wrapper in this library.
+ *
+ * @see preload()
+ */
+void preloadAll();
+} // namespace wrap
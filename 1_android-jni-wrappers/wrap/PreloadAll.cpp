@@ -0,0 +1,51 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+// Author: Ryan Pavlik <ryan.pavlik@collabora.com>
+
+#include "Preload.h"
+#include "android.app.h"
+#include "android.content.h"
+#include "android.content.pm.h"
+#include "android.database.h"
+#include "android.graphics.h"
+#include "android.net.h"
+#include "android.os.h"
+#include "android.provider.h"
+#include "android.service.vr.h"
+#include "android.text.h"
+#include "android.util.h"
+#include "android.view.h"
+#include "android.widget.h"
+#include "dalvik.system.h"
+#include "java.io.h"
+#include "java.lang.h"
+#include "java.util.h"
+
+namespace wrap {
+void preloadAll() {
+    preload<android::app::Service, android::app::Activity,
+            android::os::BaseBundle, android::os::Bundle,
+            android::os::ParcelFileDescriptor, android::content::Context,
+            android::content::ContentUris, android::content::ComponentName,
+            android::content::Intent, android::content::ContentResolver,
+            android::content::pm::PackageItemInfo,
+            android::content::pm::ComponentInfo,
+            android::content::pm::ServiceInfo,
+            android::content::pm::ApplicationInfo,
+            android::content::pm::PackageInfo,
+            android::content::pm::ResolveInfo,
+            android::content::pm::PackageManager, android::database::Cursor,
+            android::service::vr::VrListenerService,
+            android::util::DisplayMetrics, android::provider::Settings,
+            dalvik::system::DexClassLoader, java::lang::Class,
+            java::lang::ClassLoader, java::lang::System, java::lang::Math,
+            android::net::Uri, android::net::Uri_Builder,
+            android::view::Display, android::view::Surface,
+            android::view::SurfaceHolder, android::graphics::Point,
+            android::graphics::Bitmap, android::graphics::Paint,
+            android::graphics::Canvas, android::graphics::Color,
+            android::text::TextUtils, android::widget::Toast, java::util::List,
+            java::io::File, java::io::OutputStream,
+            java::io::FileOutputStream, java::io::InputStream>();
+}
+} // namespace wrap
@@ -0,0 +1,141 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "Snapshot.h"
+
+#include "android.graphics.h"
+#include "android.os.h"
+#include "android.util.h"
+
+#include <jnipp.h>
+
+#include <cassert>
+
+namespace wrap {
+namespace {
+/*!
+ * Method IDs used to unbox Bundle values.
+ */
+struct BoxedValues {
+    BoxedValues()
+        : setToArray(jni::Class("java/util/Set")
+                         .getMethod("toArray", "()[Ljava/lang/Object;")),
+          intValue(jni::getWellKnownClass(jni::IntegerClass)
+                       .getMethod("intValue", "()I")),
+          booleanValue(jni::getWellKnownClass(jni::BooleanClass)
+                           .getMethod("booleanValue", "()Z")),
+          longValue(jni::getWellKnownClass(jni::LongClass)
+                        .getMethod("longValue", "()J")) {}
+
+    jni::method_t setToArray;
+    jni::method_t intValue;
+    jni::method_t booleanValue;
+    jni::method_t longValue;
+};
+
+std::string toString(JNIEnv *env, jstring str) {
+    if (str == nullptr) {
+        return {};
+    }
+    const char *chars = env->GetStringUTFChars(str, nullptr);
+    std::string result(chars, std::size_t(env->GetStringUTFLength(str)));
+    env->ReleaseStringUTFChars(str, chars);
+    return result;
+}
+
+bool isInstance(JNIEnv *env, jobject obj, jni::WellKnownClass which) {
+    return env->IsInstanceOf(obj, jni::getWellKnownClass(which).getHandle());
+}
+
+BundleValue toBundleValue(JNIEnv *env, jobject value,
+                          BoxedValues const &boxed) {
+    if (value == nullptr) {
+        return {};
+    }
+    // Name each alternative: converting construction from bool is ambiguous
+    // with some standard libraries.
+    if (isInstance(env, value, jni::StringClass)) {
+        return BundleValue(std::in_place_type<std::string>,
+                           toString(env, static_cast<jstring>(value)));
+    }
+    if (isInstance(env, value, jni::IntegerClass)) {
+        return BundleValue(std::in_place_type<int32_t>,
+                           env->CallIntMethod(value, boxed.intValue));
+    }
+    if (isInstance(env, value, jni::BooleanClass)) {
+        return BundleValue(std::in_place_type<bool>,
+                           env->CallBooleanMethod(value, boxed.booleanValue) !=
+                               JNI_FALSE);
+    }
+    if (isInstance(env, value, jni::LongClass)) {
+        return BundleValue(std::in_place_type<int64_t>,
+                           env->CallLongMethod(value, boxed.longValue));
+    }
+    return {};
+}
+
+void checkException(JNIEnv *env) {
+    if (env->ExceptionCheck()) {
+        jni::internal::checkJavaExceptions();
+    }
+}
+} // namespace
+
+PointValue snapshot(android::graphics::Point const &point) {
+    static const jni::FieldSet<PointValue> fields = [] {
+        jni::FieldSet<PointValue> set(android::graphics::Point::getTypeName());
+        set.add("x", &PointValue::x).add("y", &PointValue::y);
+        return set;
+    }();
+    return fields.read(point.object());
+}
+
+DisplayMetricsValue snapshot(android::util::DisplayMetrics const &metrics) {
+    using V = DisplayMetricsValue;
+    static const jni::FieldSet<V> fields = [] {
+        jni::FieldSet<V> set(android::util::DisplayMetrics::getTypeName());
+        set.add("widthPixels", &V::widthPixels)
+            .add("heightPixels", &V::heightPixels)
+            .add("density", &V::density)
+            .add("densityDpi", &V::densityDpi)
+            .add("xdpi", &V::xdpi)
+            .add("ydpi", &V::ydpi);
+        return set;
+    }();
+    return fields.read(metrics.object());
+}
+
+BundleSnapshot snapshot(android::os::BaseBundle const &bundle) {
+    assert(!bundle.isNull());
+    static const BoxedValues boxed;
+    auto &meta = android::os::BaseBundle::Meta::data();
+
+    JNIEnv *env = jni::env();
+    jobject handle = bundle.object().getHandle();
+    jni::LocalFrame frame(env, 8);
+
+    jobject keySet = env->CallObjectMethod(handle, meta.keySet.id);
+    checkException(env);
+    auto keys = static_cast<jobjectArray>(
+        env->CallObjectMethod(keySet, boxed.setToArray));
+    checkException(env);
+
+    jsize count = env->GetArrayLength(keys);
+    BundleSnapshot result;
+    result.reserve(std::size_t(count));
+    for (jsize i = 0; i < count; ++i) {
+        auto key = static_cast<jstring>(env->GetObjectArrayElement(keys, i));
+        if (key == nullptr) {
+            // Would be indistinguishable from an empty key: leave it out.
+            continue;
+        }
+        jobject value = env->CallObjectMethod(handle, meta.get.id, key);
+        checkException(env);
+        result.emplace(toString(env, key), toBundleValue(env, value, boxed));
+        checkException(env);
+        env->DeleteLocalRef(value);
+        env->DeleteLocalRef(key);
+    }
+    return result;
+}
+} // namespace wrap
@@ -0,0 +1,80 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <variant>
+
+namespace wrap {
+namespace android::graphics {
+class Point;
+} // namespace android::graphics
+
+namespace android::os {
+class BaseBundle;
+} // namespace android::os
+
+namespace android::util {
+class DisplayMetrics;
+} // namespace android::util
+
+/*!
+ * Plain copy of the fields of an android.graphics.Point.
+ */
+struct PointValue {
+    int32_t x;
+    int32_t y;
+};
+
+/*!
+ * Plain copy of the commonly-used fields of an android.util.DisplayMetrics.
+ */
+struct DisplayMetricsValue {
+    int32_t widthPixels;
+    int32_t heightPixels;
+    float density;
+    int32_t densityDpi;
+    float xdpi;
+    float ydpi;
+};
+
+/*!
+ * Read all fields of @p point at once.
+ *
+ * Cheaper than calling getX() and getY() separately: the field IDs are
+ * resolved once per process and all fields are read with a single JNI
+ * environment lookup (see jni::FieldSet).
+ */
+PointValue snapshot(android::graphics::Point const &point);
+
+/*!
+ * Read the fields of @p metrics listed in DisplayMetricsValue at once.
+ *
+ * @see snapshot(android::graphics::Point const &)
+ */
+DisplayMetricsValue snapshot(android::util::DisplayMetrics const &metrics);
+
+/*!
+ * A value read from a Bundle: empty for null or unsupported value types.
+ */
+using BundleValue =
+    std::variant<std::monostate, std::string, int32_t, bool, int64_t>;
+
+/*!
+ * Every entry of a Bundle, by key.
+ */
+using BundleSnapshot = std::unordered_map<std::string, BundleValue>;
+
+/*!
+ * Read every entry of @p bundle at once.
+ *
+ * Fetches the key set once, then reads each value with a single call, all
+ * with one JNI environment lookup inside one local frame. String, int,
+ * boolean and long values are converted; any other value is recorded as
+ * std::monostate. An entry with a null key is skipped.
+ */
+BundleSnapshot snapshot(android::os::BaseBundle const &bundle);
+} // namespace wrap
@@ -0,0 +1,59 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "StreamReader.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace wrap {
+StreamReader::StreamReader(java::io::InputStream stream,
+                           std::size_t chunkSize)
+    : stream_(std::move(stream)), chunkSize_(chunkSize),
+      array_(long(chunkSize)) {
+    assert(chunkSize > 0);
+}
+
+std::size_t StreamReader::read(void *dest, std::size_t size) {
+    std::size_t count = fill(std::min(size, chunkSize_));
+    if (count > 0) {
+        array_.getRegion(0, long(count), static_cast<jni::byte_t *>(dest));
+    }
+    return count;
+}
+
+bool StreamReader::readFully(void *dest, std::size_t size) {
+    auto bytes = static_cast<jni::byte_t *>(dest);
+    while (size > 0) {
+        std::size_t count = read(bytes, size);
+        if (count == 0) {
+            return false;
+        }
+        bytes += count;
+        size -= count;
+    }
+    return true;
+}
+
+StreamReader::Chunk StreamReader::readChunk() {
+    buffer_.resize(chunkSize_);
+    std::size_t count = read(buffer_.data(), chunkSize_);
+    return Chunk{buffer_.data(), count};
+}
+
+int64_t StreamReader::skip(int64_t count) { return stream_.skip(count); }
+
+int32_t StreamReader::available() { return stream_.available(); }
+
+void StreamReader::close() { stream_.close(); }
+
+std::size_t StreamReader::fill(std::size_t size) {
+    if (size == 0) {
+        return 0;
+    }
+    int32_t count = java::io::InputStream::Meta::data().read2.call(
+        stream_.object(), array_, 0, int32_t(size));
+    // -1 marks the end of the stream.
+    return count > 0 ? std::size_t(count) : 0;
+}
+} // namespace wrap
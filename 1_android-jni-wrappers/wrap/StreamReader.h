@@ -0,0 +1,133 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "java.io.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace wrap {
+/*!
+ * Reader pulling bytes from any java.io.InputStream into C++.
+ *
+ * Every read goes through one call to `read(byte[], int, int)` on a single
+ * Java byte array of `chunkSize` bytes, allocated once and reused. The bytes
+ * then reach native memory either by an array region copy (read(),
+ * readFully(), readChunk()) or, with readCritical(), are visited in place
+ * without any copy.
+ */
+class StreamReader {
+  public:
+    /*!
+     * A view of bytes owned by the reader.
+     *
+     * Valid until the next call on the reader.
+     */
+    struct Chunk {
+        const jni::byte_t *data = nullptr;
+        std::size_t size = 0;
+
+        bool empty() const noexcept { return size == 0; }
+    };
+
+    /*!
+     * Wrap @p stream, reading up to @p chunkSize bytes at a time, which must
+     * not be zero.
+     */
+    explicit StreamReader(java::io::InputStream stream,
+                          std::size_t chunkSize = 64 * 1024);
+
+    StreamReader(StreamReader const &) = delete;
+    StreamReader &operator=(StreamReader const &) = delete;
+
+    /*!
+     * Read at most @p size bytes into @p dest, with a single Java call.
+     *
+     * @return the number of bytes read, or 0 at the end of the stream.
+     */
+    std::size_t read(void *dest, std::size_t size);
+
+    /*!
+     * Read exactly @p size bytes into @p dest.
+     *
+     * @return false if the stream ended first, in which case the contents of
+     * @p dest are unspecified.
+     */
+    bool readFully(void *dest, std::size_t size);
+
+    /*!
+     * Read the next chunk of up to `chunkSize` bytes into a buffer owned by
+     * the reader.
+     *
+     * @return the bytes read, empty at the end of the stream.
+     */
+    Chunk readChunk();
+
+    /*!
+     * Read the next chunk and pass it to @p visit as
+     * `(const jni::byte_t *data, std::size_t size)`, directly from the Java
+     * array's storage.
+     *
+     * The array is held with GetPrimitiveArrayCritical while @p visit runs,
+     * so it must be short, must not block, and must not call into Java or
+     * JNI in any way.
+     *
+     * @return the number of bytes visited, or 0 at the end of the stream (in
+     * which case @p visit is not called).
+     */
+    template <typename F> std::size_t readCritical(F &&visit);
+
+    /*!
+     * Skip over up to @p count bytes.
+     *
+     * @return the number of bytes actually skipped.
+     */
+    int64_t skip(int64_t count);
+
+    /*!
+     * Estimate of the number of bytes that can be read without blocking.
+     */
+    int32_t available();
+
+    /*!
+     * Close the Java stream.
+     */
+    void close();
+
+  private:
+    std::size_t fill(std::size_t size);
+
+    java::io::InputStream stream_;
+    std::size_t chunkSize_;
+    jni::Array<jni::byte_t> array_;
+    std::vector<jni::byte_t> buffer_;
+};
+
+template <typename F> inline std::size_t StreamReader::readCritical(F &&visit) {
+    std::size_t count = fill(chunkSize_);
+    if (count == 0) {
+        return 0;
+    }
+    JNIEnv *env = jni::env();
+    jarray handle = array_.getHandle();
+    void *bytes = env->GetPrimitiveArrayCritical(handle, nullptr);
+    if (bytes == nullptr) {
+        jni::internal::checkJavaExceptions();
+        return 0;
+    }
+    // Release even if visit throws; nothing was written, so no copy back.
+    struct Release {
+        JNIEnv *env;
+        jarray handle;
+        void *bytes;
+        ~Release() {
+            env->ReleasePrimitiveArrayCritical(handle, bytes, JNI_ABORT);
+        }
+    } release{env, handle, bytes};
+    visit(static_cast<const jni::byte_t *>(bytes), count);
+    return count;
+}
+} // namespace wrap
@@ -0,0 +1,182 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#include "TextBatch.h"
+
+#include <jnipp.h>
+
+#include <cassert>
+#include <functional>
+
+namespace wrap {
+void appendUtf16(std::string const &text, std::vector<uint16_t> &out) {
+    constexpr uint32_t replacement = 0xFFFD;
+    auto bytes = reinterpret_cast<const unsigned char *>(text.data());
+    std::size_t size = text.size();
+    for (std::size_t i = 0; i < size;) {
+        unsigned char lead = bytes[i];
+        uint32_t codePoint;
+        std::size_t length;
+        if (lead < 0x80) {
+            codePoint = lead;
+            length = 1;
+        } else if ((lead & 0xE0) == 0xC0) {
+            codePoint = lead & 0x1F;
+            length = 2;
+        } else if ((lead & 0xF0) == 0xE0) {
+            codePoint = lead & 0x0F;
+            length = 3;
+        } else if ((lead & 0xF8) == 0xF0) {
+            codePoint = lead & 0x07;
+            length = 4;
+        } else {
+            out.push_back(replacement);
+            ++i;
+            continue;
+        }
+        std::size_t consumed = 1;
+        while (consumed < length && i + consumed < size &&
+               (bytes[i + consumed] & 0xC0) == 0x80) {
+            codePoint = (codePoint << 6) | (bytes[i + consumed] & 0x3F);
+            ++consumed;
+        }
+        i += consumed;
+        if (consumed < length || codePoint > 0x10FFFF) {
+            codePoint = replacement;
+        }
+        if (codePoint >= 0x10000) {
+            codePoint -= 0x10000;
+            out.push_back(uint16_t(0xD800 + (codePoint >> 10)));
+            out.push_back(uint16_t(0xDC00 + (codePoint & 0x3FF)));
+        } else {
+            out.push_back(uint16_t(codePoint));
+        }
+    }
+}
+
+TextMeasureCache::TextMeasureCache(std::size_t capacity)
+    : capacity_(capacity) {
+    assert(capacity > 0);
+}
+
+std::size_t
+TextMeasureCache::KeyHash::operator()(Key const &key) const noexcept {
+    std::size_t hash = std::hash<std::string>{}(key.text);
+    return hash ^ (std::hash<float>{}(key.textSize) + 0x9e3779b9 +
+                   (hash << 6) + (hash >> 2));
+}
+
+bool TextMeasureCache::find(std::string const &text, float textSize,
+                            float &width) {
+    auto it = index_.find(Key{text, textSize});
+    if (it == index_.end()) {
+        return false;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    width = it->second->width;
+    return true;
+}
+
+void TextMeasureCache::insert(std::string const &text, float textSize,
+                              float width) {
+    Key key{text, textSize};
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        it->second->width = width;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return;
+    }
+    if (entries_.size() >= capacity_) {
+        index_.erase(entries_.back().key);
+        entries_.pop_back();
+    }
+    entries_.push_front(Entry{key, width});
+    index_.emplace(std::move(key), entries_.begin());
+}
+
+void TextMeasureCache::clear() noexcept {
+    index_.clear();
+    entries_.clear();
+}
+
+TextBatch::TextBatch(android::graphics::Paint paint,
+                     std::size_t cacheCapacity)
+    : paint_(std::move(paint)), textSize_(paint_.getTextSize()),
+      cache_(cacheCapacity) {}
+
+void TextBatch::setTextSize(float textSize) {
+    paint_.setTextSize(textSize);
+    textSize_ = textSize;
+}
+
+float TextBatch::measure(std::string const &text) {
+    float width = 0;
+    if (cache_.find(text, textSize_, width)) {
+        return width;
+    }
+    // Measure through the shared array too: still no jstring needed.
+    scratch_.clear();
+    appendUtf16(text, scratch_);
+    if (!scratch_.empty()) {
+        upload(scratch_.data(), scratch_.size());
+        width = paint_.measureText(array_, 0, int32_t(scratch_.size()));
+    }
+    cache_.insert(text, textSize_, width);
+    return width;
+}
+
+void TextBatch::add(std::string const &text, float x, float y,
+                    int32_t color) {
+    std::size_t offset = chars_.size();
+    appendUtf16(text, chars_);
+    labels_.push_back(Label{offset, chars_.size() - offset, x, y, color});
+}
+
+void TextBatch::draw(android::graphics::Canvas &canvas) {
+    if (chars_.empty()) {
+        clear();
+        return;
+    }
+    upload(chars_.data(), chars_.size());
+    bool first = true;
+    int32_t color = 0;
+    for (Label const &label : labels_) {
+        if (label.length == 0) {
+            continue;
+        }
+        if (first || label.color != color) {
+            paint_.setColor(label.color);
+            color = label.color;
+            first = false;
+        }
+        canvas.drawText(array_, int32_t(label.offset), int32_t(label.length),
+                        label.x, label.y, paint_);
+    }
+    clear();
+}
+
+void TextBatch::clear() noexcept {
+    chars_.clear();
+    labels_.clear();
+}
+
+void TextBatch::upload(const uint16_t *chars, std::size_t count) {
+    JNIEnv *env = jni::env();
+    if (count > arrayCapacity_) {
+        // Grow geometrically, so that a steady frame stops reallocating.
+        std::size_t capacity = arrayCapacity_ == 0 ? 256 : arrayCapacity_;
+        while (capacity < count) {
+            capacity *= 2;
+        }
+        jcharArray array = env->NewCharArray(jsize(capacity));
+        if (array == nullptr) {
+            jni::internal::checkJavaExceptions();
+        }
+        array_ = jni::Array<uint16_t>(array, jni::Object::DeleteLocalInput);
+        arrayCapacity_ = capacity;
+    }
+    env->SetCharArrayRegion(static_cast<jcharArray>(array_.getHandle()), 0,
+                            jsize(count),
+                            reinterpret_cast<const jchar *>(chars));
+}
+} // namespace wrap
@@ -0,0 +1,142 @@
+// Copyright 2020-2021, Collabora, Ltd.
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include "android.graphics.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace wrap {
+/*!
+ * Append the UTF-16 encoding of the UTF-8 @p text to @p out, replacing each
+ * malformed or truncated sequence with U+FFFD.
+ */
+void appendUtf16(std::string const &text, std::vector<uint16_t> &out);
+
+/*!
+ * Least-recently-used cache of text widths, keyed by text and text size.
+ */
+class TextMeasureCache {
+  public:
+    explicit TextMeasureCache(std::size_t capacity = 256);
+
+    /*!
+     * Look up the width of @p text at @p textSize, marking it as recently
+     * used.
+     *
+     * @return true and set @p width if found.
+     */
+    bool find(std::string const &text, float textSize, float &width);
+
+    /*!
+     * Remember the width of @p text at @p textSize, evicting the least
+     * recently used entry if full.
+     */
+    void insert(std::string const &text, float textSize, float width);
+
+    std::size_t size() const noexcept { return entries_.size(); }
+
+    void clear() noexcept;
+
+  private:
+    struct Key {
+        std::string text;
+        float textSize;
+        bool operator==(Key const &other) const {
+            return textSize == other.textSize && text == other.text;
+        }
+    };
+    struct KeyHash {
+        std::size_t operator()(Key const &key) const noexcept;
+    };
+    struct Entry {
+        Key key;
+        float width;
+    };
+
+    std::size_t capacity_;
+    //! Most recently used first.
+    std::list<Entry> entries_;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index_;
+};
+
+/*!
+ * Collects text labels in C++ and draws them with few JNI calls and no
+ * jstrings.
+ *
+ * All labels of a draw() are packed as UTF-16 into one Java char[], reused
+ * from frame to frame and filled with a single region copy. Each label is
+ * then drawn with `Canvas.drawText(char[], int, int, float, float, Paint)`,
+ * calling `Paint.setColor` only when the color changes between consecutive
+ * labels. Labels are drawn in the order they were added.
+ *
+ * Widths from measure() are cached in a TextMeasureCache.
+ */
+class TextBatch {
+  public:
+    /*!
+     * Draw with @p paint, keeping up to @p cacheCapacity measured widths.
+     */
+    explicit TextBatch(android::graphics::Paint paint,
+                       std::size_t cacheCapacity = 256);
+
+    TextBatch(TextBatch const &) = delete;
+    TextBatch &operator=(TextBatch const &) = delete;
+
+    /*!
+     * Set the text size of the paint, for measuring and drawing.
+     */
+    void setTextSize(float textSize);
+
+    float textSize() const noexcept { return textSize_; }
+
+    /*!
+     * Width of the UTF-8 @p text at the current text size.
+     */
+    float measure(std::string const &text);
+
+    /*!
+     * Queue the UTF-8 @p text to be drawn at (@p x, @p y) in ARGB @p color.
+     */
+    void add(std::string const &text, float x, float y, int32_t color);
+
+    /*!
+     * Draw all queued labels on @p canvas, then clear the queue.
+     */
+    void draw(android::graphics::Canvas &canvas);
+
+    /*!
+     * Discard all queued labels.
+     */
+    void clear() noexcept;
+
+    std::size_t size() const noexcept { return labels_.size(); }
+
+  private:
+    struct Label {
+        std::size_t offset;
+        std::size_t length;
+        float x;
+        float y;
+        int32_t color;
+    };
+
+    void upload(const uint16_t *chars, std::size_t count);
+
+    android::graphics::Paint paint_;
+    float textSize_;
+    TextMeasureCache cache_;
+    std::vector<uint16_t> chars_;
+    //! Text being measured, reused like chars_.
+    std::vector<uint16_t> scratch_;
+    std::vector<Label> labels_;
+    jni::Array<uint16_t> array_;
+    std::size_t arrayCapacity_ = 0;
+};
+} // namespace wrap
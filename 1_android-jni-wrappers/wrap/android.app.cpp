@@ -11,10 +11,10 @@ Service::Meta::Meta() : MetaBaseDroppable(Service::getTypeName()) {
 }
 Activity::Meta::Meta()
     : MetaBaseDroppable(Activity::getTypeName()),
-      getSystemService(classRef().getMethod(
-          "getSystemService", "(Ljava/lang/String;)Ljava/lang/Object;")),
-      setVrModeEnabled(classRef().getMethod(
-          "setVrModeEnabled", "(ZLandroid/content/ComponentName;)V")) {
+      getSystemService(classRef(), "getSystemService",
+                       "(Ljava/lang/String;)Ljava/lang/Object;"),
+      setVrModeEnabled(classRef(), "setVrModeEnabled",
+                       "(ZLandroid/content/ComponentName;)V") {
     MetaBaseDroppable::dropClassRef();
 }
 } // namespace android::app
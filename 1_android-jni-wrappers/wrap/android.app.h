@@ -80,8 +80,8 @@ class Activity : public content::Context {
      * Class metadata
      */
     struct Meta : public MetaBaseDroppable {
-        jni::method_t getSystemService;
-        jni::method_t setVrModeEnabled;
+        impl::MethodId<jni::Object(std::string)> getSystemService;
+        impl::MethodId<void(bool, jni::Object)> setVrModeEnabled;
 
         /*!
          * Singleton accessor
@@ -12,15 +12,14 @@ namespace android::app {
 
 inline jni::Object Activity::getSystemService(std::string &stringParam) {
     assert(!isNull());
-    return object().call<jni::Object>(Meta::data().getSystemService,
-                                      stringParam);
+    return Meta::data().getSystemService.call(object(), stringParam);
 }
 
 inline void Activity::setVrModeEnabled(bool booleanParam,
                                        content::ComponentName &componentName) {
     assert(!isNull());
-    return object().call<void>(Meta::data().setVrModeEnabled, booleanParam,
-                               componentName.object());
+    return Meta::data().setVrModeEnabled.call(object(), booleanParam,
+                                              componentName.object());
 }
 } // namespace android::app
 } // namespace wrap
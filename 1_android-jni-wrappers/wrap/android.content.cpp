@@ -10,30 +10,26 @@ Context::Meta::Meta(bool deferDrop)
     : MetaBaseDroppable(Context::getTypeName()),
       DISPLAY_SERVICE(classRef(), "DISPLAY_SERVICE"),
       WINDOW_SERVICE(classRef(), "WINDOW_SERVICE"),
-      getPackageManager(classRef().getMethod(
-          "getPackageManager", "()Landroid/content/pm/PackageManager;")),
-      getContentResolver(classRef().getMethod(
-          "getContentResolver", "()Landroid/content/ContentResolver;")),
-      getApplicationContext(classRef().getMethod(
-          "getApplicationContext", "()Landroid/content/Context;")),
-      getClassLoader(
-          classRef().getMethod("getClassLoader", "()Ljava/lang/ClassLoader;")),
-      startActivity(
-          classRef().getMethod("startActivity", "(Landroid/content/Intent;)V")),
-      startActivity1(classRef().getMethod(
-          "startActivity", "(Landroid/content/Intent;Landroid/os/Bundle;)V")),
-      createPackageContext(classRef().getMethod(
-          "createPackageContext",
-          "(Ljava/lang/String;I)Landroid/content/Context;")) {
+      getPackageManager(classRef(), "getPackageManager",
+                        "()Landroid/content/pm/PackageManager;"),
+      getContentResolver(classRef(), "getContentResolver",
+                         "()Landroid/content/ContentResolver;"),
+      getApplicationContext(classRef(), "getApplicationContext",
+                            "()Landroid/content/Context;"),
+      getClassLoader(classRef(), "getClassLoader", "()Ljava/lang/ClassLoader;"),
+      startActivity(classRef(), "startActivity", "(Landroid/content/Intent;)V"),
+      startActivity1(classRef(), "startActivity",
+                     "(Landroid/content/Intent;Landroid/os/Bundle;)V"),
+      createPackageContext(classRef(), "createPackageContext",
+                           "(Ljava/lang/String;I)Landroid/content/Context;") {
     if (!deferDrop) {
         MetaBaseDroppable::dropClassRef();
     }
 }
 ContentUris::Meta::Meta(bool deferDrop)
     : MetaBaseDroppable(ContentUris::getTypeName()),
-      appendId(classRef().getStaticMethod(
-          "appendId",
-          "(Landroid/net/Uri$Builder;J)Landroid/net/Uri$Builder;")) {
+      appendId(classRef(), "appendId",
+               "(Landroid/net/Uri$Builder;J)Landroid/net/Uri$Builder;") {
     if (!deferDrop) {
         MetaBaseDroppable::dropClassRef();
     }
@@ -60,22 +56,19 @@ Intent::Meta::Meta()
       init5(classRef().getMethod("<init>",
                                  "(Ljava/lang/String;Landroid/net/Uri;Landroid/"
                                  "content/Context;Ljava/lang/Class;)V")),
-      setFlags(
-          classRef().getMethod("setFlags", "(I)Landroid/content/Intent;")) {}
+      setFlags(classRef(), "setFlags", "(I)Landroid/content/Intent;") {}
 ContentResolver::Meta::Meta()
     : MetaBaseDroppable(ContentResolver::getTypeName()),
-      query(classRef().getMethod(
-          "query",
-          "(Landroid/net/Uri;[Ljava/lang/String;Ljava/lang/String;[Ljava/lang/"
-          "String;Ljava/lang/String;)Landroid/database/Cursor;")),
-      query1(classRef().getMethod(
-          "query", "(Landroid/net/Uri;[Ljava/lang/String;Ljava/lang/"
-                   "String;[Ljava/lang/String;Ljava/lang/String;Landroid/os/"
-                   "CancellationSignal;)Landroid/database/Cursor;")),
-      query2(classRef().getMethod(
-          "query",
-          "(Landroid/net/Uri;[Ljava/lang/String;Landroid/os/Bundle;Landroid/os/"
-          "CancellationSignal;)Landroid/database/Cursor;")) {
+      query(classRef(), "query",
+            "(Landroid/net/Uri;[Ljava/lang/String;Ljava/lang/String;[Ljava/"
+            "lang/String;Ljava/lang/String;)Landroid/database/Cursor;"),
+      query1(classRef(), "query",
+             "(Landroid/net/Uri;[Ljava/lang/String;Ljava/lang/String;[Ljava/"
+             "lang/String;Ljava/lang/String;Landroid/os/CancellationSignal;"
+             ")Landroid/database/Cursor;"),
+      query2(classRef(), "query",
+             "(Landroid/net/Uri;[Ljava/lang/String;Landroid/os/Bundle;"
+             "Landroid/os/CancellationSignal;)Landroid/database/Cursor;") {
     MetaBaseDroppable::dropClassRef();
 }
 } // namespace android::content
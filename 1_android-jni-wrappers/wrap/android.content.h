@@ -159,13 +159,13 @@ class Context : public ObjectWrapperBase {
     struct Meta : public MetaBaseDroppable {
         impl::StaticFieldId<std::string> DISPLAY_SERVICE;
         impl::StaticFieldId<std::string> WINDOW_SERVICE;
-        jni::method_t getPackageManager;
-        jni::method_t getContentResolver;
-        jni::method_t getApplicationContext;
-        jni::method_t getClassLoader;
-        jni::method_t startActivity;
-        jni::method_t startActivity1;
-        jni::method_t createPackageContext;
+        impl::MethodId<jni::Object()> getPackageManager;
+        impl::MethodId<jni::Object()> getContentResolver;
+        impl::MethodId<jni::Object()> getApplicationContext;
+        impl::MethodId<jni::Object()> getClassLoader;
+        impl::MethodId<void(jni::Object)> startActivity;
+        impl::MethodId<void(jni::Object, jni::Object)> startActivity1;
+        impl::MethodId<jni::Object(std::string, int32_t)> createPackageContext;
 
         /*!
          * Singleton accessor
@@ -206,7 +206,7 @@ class ContentUris : public ObjectWrapperBase {
      * Class metadata
      */
     struct Meta : public MetaBaseDroppable {
-        jni::method_t appendId;
+        impl::StaticMethodId<jni::Object(jni::Object, int64_t)> appendId;
 
         /*!
          * Singleton accessor
@@ -413,7 +413,7 @@ class Intent : public ObjectWrapperBase {
         jni::method_t init3;
         jni::method_t init4;
         jni::method_t init5;
-        jni::method_t setFlags;
+        impl::MethodId<jni::Object(int32_t)> setFlags;
 
         /*!
          * Singleton accessor
@@ -490,9 +490,17 @@ class ContentResolver : public ObjectWrapperBase {
      * Class metadata
      */
     struct Meta : public MetaBaseDroppable {
-        jni::method_t query;
-        jni::method_t query1;
-        jni::method_t query2;
+        impl::MethodId<jni::Object(jni::Object, jni::Array<std::string>,
+                                   std::string, jni::Array<std::string>,
+                                   std::string)>
+            query;
+        impl::MethodId<jni::Object(jni::Object, jni::Array<std::string>,
+                                   std::string, jni::Array<std::string>,
+                                   std::string, jni::Object)>
+            query1;
+        impl::MethodId<jni::Object(jni::Object, jni::Array<std::string>,
+                                   jni::Object, jni::Object)>
+            query2;
 
         /*!
          * Singleton accessor
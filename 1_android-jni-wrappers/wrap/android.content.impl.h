@@ -15,66 +15,56 @@ namespace wrap {
 namespace android::content {
 inline std::string Context::DISPLAY_SERVICE() {
     auto &data = Meta::data(true);
-    auto ret = get(data.DISPLAY_SERVICE, data.clazz());
-    data.dropClassRef();
-    return ret;
+    return get(data.DISPLAY_SERVICE, data.clazz());
 }
 
 inline std::string Context::WINDOW_SERVICE() {
     auto &data = Meta::data(true);
-    auto ret = get(data.WINDOW_SERVICE, data.clazz());
-    data.dropClassRef();
-    return ret;
+    return get(data.WINDOW_SERVICE, data.clazz());
 }
 
 inline pm::PackageManager Context::getPackageManager() {
     assert(!isNull());
-    return pm::PackageManager(
-        object().call<jni::Object>(Meta::data().getPackageManager));
+    return pm::PackageManager(Meta::data().getPackageManager.call(object()));
 }
 
 inline ContentResolver Context::getContentResolver() {
     assert(!isNull());
-    return ContentResolver(
-        object().call<jni::Object>(Meta::data().getContentResolver));
+    return ContentResolver(Meta::data().getContentResolver.call(object()));
 }
 
 inline Context Context::getApplicationContext() {
     assert(!isNull());
-    return Context(
-        object().call<jni::Object>(Meta::data().getApplicationContext));
+    return Context(Meta::data().getApplicationContext.call(object()));
 }
 
 inline java::lang::ClassLoader Context::getClassLoader() {
     assert(!isNull());
-    return java::lang::ClassLoader(
-        object().call<jni::Object>(Meta::data().getClassLoader));
+    return java::lang::ClassLoader(Meta::data().getClassLoader.call(object()));
 }
 
 inline void Context::startActivity(Intent &intent) {
     assert(!isNull());
-    return object().call<void>(Meta::data().startActivity, intent.object());
+    return Meta::data().startActivity.call(object(), intent.object());
 }
 
 inline void Context::startActivity(Intent &intent, os::Bundle &bundle) {
     assert(!isNull());
-    return object().call<void>(Meta::data().startActivity1, intent.object(),
-                               bundle.object());
+    return Meta::data().startActivity1.call(object(), intent.object(),
+                                            bundle.object());
 }
 
 inline Context Context::createPackageContext(std::string &stringParam,
                                              int32_t intParam) {
     assert(!isNull());
-    return Context(object().call<jni::Object>(Meta::data().createPackageContext,
-                                              stringParam, intParam));
+    return Context(Meta::data().createPackageContext.call(object(), stringParam,
+                                                          intParam));
 }
 inline net::Uri_Builder ContentUris::appendId(net::Uri_Builder &uri_Builder,
                                               int64_t longParam) {
     auto &data = Meta::data(true);
-    auto ret = net::Uri_Builder(data.clazz().call<jni::Object>(
-        data.appendId, uri_Builder.object(), longParam));
-    data.dropClassRef();
-    return ret;
+    return net::Uri_Builder(
+        data.appendId.call(data.clazz(), uri_Builder.object(), longParam));
 }
 inline ComponentName ComponentName::construct(std::string &stringParam,
                                               std::string &stringParam1) {
@@ -137,7 +127,7 @@ inline Intent Intent::construct(std::string &stringParam, net::Uri &uri,
 
 inline Intent Intent::setFlags(int32_t intParam) {
     assert(!isNull());
-    return Intent(object().call<jni::Object>(Meta::data().setFlags, intParam));
+    return Intent(Meta::data().setFlags.call(object(), intParam));
 }
 inline database::Cursor
 ContentResolver::query(net::Uri &uri, jni::Array<std::string> &stringArray,
@@ -145,9 +135,9 @@ ContentResolver::query(net::Uri &uri, jni::Array<std::string> &stringArray,
                        jni::Array<std::string> &stringArray3,
                        std::string &stringParam4) {
     assert(!isNull());
-    return database::Cursor(object().call<jni::Object>(
-        Meta::data().query, uri.object(), stringArray, stringParam,
-        stringArray3, stringParam4));
+    return database::Cursor(Meta::data().query.call(
+        object(), uri.object(), stringArray, stringParam, stringArray3,
+        stringParam4));
 }
 
 inline database::Cursor ContentResolver::query(
@@ -155,17 +145,17 @@ inline database::Cursor ContentResolver::query(
     std::string &stringParam, jni::Array<std::string> &stringArray3,
     std::string &stringParam4, jni::Object &cancellationSignal) {
     assert(!isNull());
-    return database::Cursor(object().call<jni::Object>(
-        Meta::data().query1, uri.object(), stringArray, stringParam,
-        stringArray3, stringParam4, cancellationSignal));
+    return database::Cursor(Meta::data().query1.call(
+        object(), uri.object(), stringArray, stringParam, stringArray3,
+        stringParam4, cancellationSignal));
 }
 
 inline database::Cursor
 ContentResolver::query(net::Uri &uri, jni::Array<std::string> &stringArray,
                        os::Bundle &bundle, jni::Object &cancellationSignal) {
     assert(!isNull());
-    return database::Cursor(object().call<jni::Object>(
-        Meta::data().query2, uri.object(), stringArray, bundle.object(),
+    return database::Cursor(Meta::data().query2.call(
+        object(), uri.object(), stringArray, bundle.object(),
         cancellationSignal));
 }
 } // namespace android::content
@@ -37,34 +37,32 @@ ResolveInfo::Meta::Meta()
 }
 PackageManager::Meta::Meta()
     : MetaBaseDroppable(PackageManager::getTypeName()),
-      getPackageInfo(classRef().getMethod(
-          "getPackageInfo",
-          "(Ljava/lang/String;I)Landroid/content/pm/PackageInfo;")),
-      getPackageInfo1(classRef().getMethod(
-          "getPackageInfo",
-          "(Ljava/lang/String;Landroid/content/pm/"
-          "PackageManager$PackageInfoFlags;)Landroid/content/pm/PackageInfo;")),
-      getPackageInfo2(classRef().getMethod(
-          "getPackageInfo", "(Landroid/content/pm/VersionedPackage;I)Landroid/"
-                            "content/pm/PackageInfo;")),
-      getPackageInfo3(classRef().getMethod(
-          "getPackageInfo",
-          "(Landroid/content/pm/VersionedPackage;Landroid/content/pm/"
-          "PackageManager$PackageInfoFlags;)Landroid/content/pm/PackageInfo;")),
-      getApplicationInfo(classRef().getMethod(
-          "getApplicationInfo",
-          "(Ljava/lang/String;I)Landroid/content/pm/ApplicationInfo;")),
-      getApplicationInfo1(classRef().getMethod(
-          "getApplicationInfo", "(Ljava/lang/String;Landroid/content/pm/"
-                                "PackageManager$ApplicationInfoFlags;)Landroid/"
-                                "content/pm/ApplicationInfo;")),
-      queryIntentServices(
-          classRef().getMethod("queryIntentServices",
-                               "(Landroid/content/Intent;I)Ljava/util/List;")),
-      queryIntentServices1(classRef().getMethod(
-          "queryIntentServices",
-          "(Landroid/content/Intent;Landroid/content/pm/"
-          "PackageManager$ResolveInfoFlags;)Ljava/util/List;")) {
+      getPackageInfo(classRef(), "getPackageInfo",
+                     "(Ljava/lang/String;I)Landroid/content/pm/PackageInfo;"),
+      getPackageInfo1(classRef(), "getPackageInfo",
+                      "(Ljava/lang/String;Landroid/content/pm/"
+                      "PackageManager$PackageInfoFlags;)Landroid/content/pm/"
+                      "PackageInfo;"),
+      getPackageInfo2(classRef(), "getPackageInfo",
+                      "(Landroid/content/pm/VersionedPackage;I)Landroid/"
+                      "content/pm/PackageInfo;"),
+      getPackageInfo3(classRef(), "getPackageInfo",
+                      "(Landroid/content/pm/VersionedPackage;Landroid/"
+                      "content/pm/PackageManager$PackageInfoFlags;)Landroid/"
+                      "content/pm/PackageInfo;"),
+      getApplicationInfo(classRef(), "getApplicationInfo",
+                         "(Ljava/lang/String;I)Landroid/content/pm/"
+                         "ApplicationInfo;"),
+      getApplicationInfo1(classRef(), "getApplicationInfo",
+                          "(Ljava/lang/String;Landroid/content/pm/"
+                          "PackageManager$ApplicationInfoFlags;)Landroid/"
+                          "content/pm/ApplicationInfo;"),
+      queryIntentServices(classRef(), "queryIntentServices",
+                          "(Landroid/content/Intent;I)Ljava/util/List;"),
+      queryIntentServices1(classRef(), "queryIntentServices",
+                           "(Landroid/content/Intent;Landroid/content/pm/"
+                           "PackageManager$ResolveInfoFlags;)Ljava/util/"
+                           "List;") {
     MetaBaseDroppable::dropClassRef();
 }
 } // namespace android::content::pm
@@ -420,14 +420,16 @@ class PackageManager : public ObjectWrapperBase {
      * Class metadata
      */
     struct Meta : public MetaBaseDroppable {
-        jni::method_t getPackageInfo;
-        jni::method_t getPackageInfo1;
-        jni::method_t getPackageInfo2;
-        jni::method_t getPackageInfo3;
-        jni::method_t getApplicationInfo;
-        jni::method_t getApplicationInfo1;
-        jni::method_t queryIntentServices;
-        jni::method_t queryIntentServices1;
+        impl::MethodId<jni::Object(std::string, int32_t)> getPackageInfo;
+        impl::MethodId<jni::Object(std::string, jni::Object)> getPackageInfo1;
+        impl::MethodId<jni::Object(jni::Object, int32_t)> getPackageInfo2;
+        impl::MethodId<jni::Object(jni::Object, jni::Object)> getPackageInfo3;
+        impl::MethodId<jni::Object(std::string, int32_t)> getApplicationInfo;
+        impl::MethodId<jni::Object(std::string, jni::Object)>
+            getApplicationInfo1;
+        impl::MethodId<jni::Object(jni::Object, int32_t)> queryIntentServices;
+        impl::MethodId<jni::Object(jni::Object, jni::Object)>
+            queryIntentServices1;
 
         /*!
          * Singleton accessor
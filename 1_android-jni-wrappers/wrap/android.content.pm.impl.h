@@ -50,64 +50,60 @@ inline ServiceInfo ResolveInfo::getServiceInfo() const {
 inline PackageInfo PackageManager::getPackageInfo(std::string &stringParam,
                                                   int32_t intParam) {
     assert(!isNull());
-    return PackageInfo(object().call<jni::Object>(Meta::data().getPackageInfo,
-                                                  stringParam, intParam));
+    return PackageInfo(Meta::data().getPackageInfo.call(object(), stringParam,
+                                                        intParam));
 }
 
 inline PackageInfo
 PackageManager::getPackageInfo(std::string &stringParam,
                                jni::Object &packageManager_PackageInfoFlags) {
     assert(!isNull());
-    return PackageInfo(
-        object().call<jni::Object>(Meta::data().getPackageInfo1, stringParam,
-                                   packageManager_PackageInfoFlags));
+    return PackageInfo(Meta::data().getPackageInfo1.call(
+        object(), stringParam, packageManager_PackageInfoFlags));
 }
 
 inline PackageInfo PackageManager::getPackageInfo(jni::Object &versionedPackage,
                                                   int32_t intParam) {
     assert(!isNull());
-    return PackageInfo(object().call<jni::Object>(Meta::data().getPackageInfo2,
-                                                  versionedPackage, intParam));
+    return PackageInfo(Meta::data().getPackageInfo2.call(
+        object(), versionedPackage, intParam));
 }
 
 inline PackageInfo
 PackageManager::getPackageInfo(jni::Object &versionedPackage,
                                jni::Object &packageManager_PackageInfoFlags) {
     assert(!isNull());
-    return PackageInfo(object().call<jni::Object>(
-        Meta::data().getPackageInfo3, versionedPackage,
-        packageManager_PackageInfoFlags));
+    return PackageInfo(Meta::data().getPackageInfo3.call(
+        object(), versionedPackage, packageManager_PackageInfoFlags));
 }
 
 inline ApplicationInfo
 PackageManager::getApplicationInfo(std::string &stringParam, int32_t intParam) {
     assert(!isNull());
-    return ApplicationInfo(object().call<jni::Object>(
-        Meta::data().getApplicationInfo, stringParam, intParam));
+    return ApplicationInfo(Meta::data().getApplicationInfo.call(
+        object(), stringParam, intParam));
 }
 
 inline ApplicationInfo PackageManager::getApplicationInfo(
     std::string &stringParam,
     jni::Object &packageManager_ApplicationInfoFlags) {
     assert(!isNull());
-    return ApplicationInfo(object().call<jni::Object>(
-        Meta::data().getApplicationInfo1, stringParam,
-        packageManager_ApplicationInfoFlags));
+    return ApplicationInfo(Meta::data().getApplicationInfo1.call(
+        object(), stringParam, packageManager_ApplicationInfoFlags));
 }
 
 inline java::util::List PackageManager::queryIntentServices(Intent &intent,
                                                             int32_t intParam) {
     assert(!isNull());
-    return java::util::List(object().call<jni::Object>(
-        Meta::data().queryIntentServices, intent.object(), intParam));
+    return java::util::List(Meta::data().queryIntentServices.call(
+        object(), intent.object(), intParam));
 }
 
 inline java::util::List PackageManager::queryIntentServices(
     Intent &intent, jni::Object &packageManager_ResolveInfoFlags) {
     assert(!isNull());
-    return java::util::List(object().call<jni::Object>(
-        Meta::data().queryIntentServices1, intent.object(),
-        packageManager_ResolveInfoFlags));
+    return java::util::List(Meta::data().queryIntentServices1.call(
+        object(), intent.object(), packageManager_ResolveInfoFlags));
 }
 } // namespace android::content::pm
 } // namespace wrap
@@ -8,14 +8,13 @@ namespace wrap {
 namespace android::database {
 Cursor::Meta::Meta()
     : MetaBaseDroppable(Cursor::getTypeName()),
-      getCount(classRef().getMethod("getCount", "()I")),
-      moveToFirst(classRef().getMethod("moveToFirst", "()Z")),
-      moveToNext(classRef().getMethod("moveToNext", "()Z")),
-      getColumnIndex(
-          classRef().getMethod("getColumnIndex", "(Ljava/lang/String;)I")),
-      getString(classRef().getMethod("getString", "(I)Ljava/lang/String;")),
-      getInt(classRef().getMethod("getInt", "(I)I")),
-      close(classRef().getMethod("close", "()V")) {
+      getCount(classRef(), "getCount", "()I"),
+      moveToFirst(classRef(), "moveToFirst", "()Z"),
+      moveToNext(classRef(), "moveToNext", "()Z"),
+      getColumnIndex(classRef(), "getColumnIndex", "(Ljava/lang/String;)I"),
+      getString(classRef(), "getString", "(I)Ljava/lang/String;"),
+      getInt(classRef(), "getInt", "(I)I"),
+      close(classRef(), "close", "()V") {
     MetaBaseDroppable::dropClassRef();
 }
 } // namespace android::database
@@ -99,13 +99,13 @@ class Cursor : public ObjectWrapperBase {
      * Class metadata
      */
     struct Meta : public MetaBaseDroppable {
-        jni::method_t getCount;
-        jni::method_t moveToFirst;
-        jni::method_t moveToNext;
-        jni::method_t getColumnIndex;
-        jni::method_t getString;
-        jni::method_t getInt;
-        jni::method_t close;
+        impl::MethodId<int32_t()> getCount;
+        impl::MethodId<bool()> moveToFirst;
+        impl::MethodId<bool()> moveToNext;
+        impl::MethodId<int32_t(std::string)> getColumnIndex;
+        impl::MethodId<std::string(int32_t)> getString;
+        impl::MethodId<int32_t(int32_t)> getInt;
+        impl::MethodId<void()> close;
 
         /*!
          * Singleton accessor
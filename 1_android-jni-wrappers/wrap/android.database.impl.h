@@ -10,37 +10,37 @@ namespace wrap {
 namespace android::database {
 inline int32_t Cursor::getCount() {
     assert(!isNull());
-    return object().call<int32_t>(Meta::data().getCount);
+    return Meta::data().getCount.call(object());
 }
 
 inline bool Cursor::moveToFirst() {
     assert(!isNull());
-    return object().call<bool>(Meta::data().moveToFirst);
+    return Meta::data().moveToFirst.call(object());
 }
 
 inline bool Cursor::moveToNext() {
     assert(!isNull());
-    return object().call<bool>(Meta::data().moveToNext);
+    return Meta::data().moveToNext.call(object());
 }
 
 inline int32_t Cursor::getColumnIndex(std::string &stringParam) {
     assert(!isNull());
-    return object().call<int32_t>(Meta::data().getColumnIndex, stringParam);
+    return Meta::data().getColumnIndex.call(object(), stringParam);
 }
 
 inline std::string Cursor::getString(int32_t intParam) {
     assert(!isNull());
-    return object().call<std::string>(Meta::data().getString, intParam);
+    return Meta::data().getString.call(object(), intParam);
 }
 
 inline int32_t Cursor::getInt(int32_t intParam) {
     assert(!isNull());
-    return object().call<int32_t>(Meta::data().getInt, intParam);
+    return Meta::data().getInt.call(object(), intParam);
 }
 
 inline void Cursor::close() {
     assert(!isNull());
-    return object().call<void>(Meta::data().close);
+    return Meta::data().close.call(object());
 }
 } // namespace android::database
 } // namespace wrap
@@ -82,6 +82,28 @@ class Bitmap : public ObjectWrapperBase {
         return "android/graphics/Bitmap";
     }
 
+    /*!
+     * Wrapper for the copyPixelsToBuffer method
+     *
+     * Java prototype:
+     * `public void copyPixelsToBuffer(java.nio.Buffer);`
+     *
+     * JNI signature: (Ljava/nio/Buffer;)V
+     *
+     */
+    void copyPixelsToBuffer(jni::Object &buffer);
+
+    /*!
+     * Wrapper for the copyPixelsFromBuffer method
+     *
+     * Java prototype:
+     * `public void copyPixelsFromBuffer(java.nio.Buffer);`
+     *
+     * JNI signature: (Ljava/nio/Buffer;)V
+     *
+     */
+    void copyPixelsFromBuffer(jni::Object &buffer);
+
     /*!
      * Wrapper for the createBitmap static method
      *
@@ -324,6 +346,50 @@ class Bitmap : public ObjectWrapperBase {
     bool compress(jni::Object &bitmap_CompressFormat, int32_t intParam,
                   jni::Object &outputStream);
 
+    /*!
+     * Wrapper for the getWidth method
+     *
+     * Java prototype:
+     * `public final int getWidth();`
+     *
+     * JNI signature: ()I
+     *
+     */
+    int32_t getWidth();
+
+    /*!
+     * Wrapper for the getHeight method
+     *
+     * Java prototype:
+     * `public final int getHeight();`
+     *
+     * JNI signature: ()I
+     *
+     */
+    int32_t getHeight();
+
+    /*!
+     * Wrapper for the getRowBytes method
+     *
+     * Java prototype:
+     * `public final int getRowBytes();`
+     *
+     * JNI signature: ()I
+     *
+     */
+    int32_t getRowBytes();
+
+    /*!
+     * Wrapper for the getByteCount method
+     *
+     * Java prototype:
+     * `public final int getByteCount();`
+     *
+     * JNI signature: ()I
+     *
+     */
+    int32_t getByteCount();
+
     /*!
      * Wrapper for the eraseColor method
      *
@@ -350,24 +416,55 @@ class Bitmap : public ObjectWrapperBase {
      * Class metadata
      */
     struct Meta : public MetaBaseDroppable {
-        jni::method_t createBitmap;
-        jni::method_t createBitmap1;
-        jni::method_t createBitmap2;
-        jni::method_t createBitmap3;
-        jni::method_t createBitmap4;
-        jni::method_t createBitmap5;
-        jni::method_t createBitmap6;
-        jni::method_t createBitmap7;
-        jni::method_t createBitmap8;
-        jni::method_t createBitmap9;
-        jni::method_t createBitmap10;
-        jni::method_t createBitmap11;
-        jni::method_t createBitmap12;
-        jni::method_t createBitmap13;
-        jni::method_t createBitmap14;
-        jni::method_t compress;
-        jni::method_t eraseColor;
-        jni::method_t eraseColor1;
+        impl::MethodId<void(jni::Object)> copyPixelsToBuffer;
+        impl::MethodId<void(jni::Object)> copyPixelsFromBuffer;
+        impl::StaticMethodId<jni::Object(jni::Object)> createBitmap;
+        impl::StaticMethodId<jni::Object(jni::Object, int32_t, int32_t, int32_t,
+                                         int32_t)>
+            createBitmap1;
+        impl::StaticMethodId<jni::Object(jni::Object, int32_t, int32_t, int32_t,
+                                         int32_t, jni::Object, bool)>
+            createBitmap2;
+        impl::StaticMethodId<jni::Object(int32_t, int32_t, jni::Object)>
+            createBitmap3;
+        impl::StaticMethodId<jni::Object(jni::Object, int32_t, int32_t,
+                                         jni::Object)>
+            createBitmap4;
+        impl::StaticMethodId<jni::Object(int32_t, int32_t, jni::Object, bool)>
+            createBitmap5;
+        impl::StaticMethodId<jni::Object(int32_t, int32_t, jni::Object, bool,
+                                         jni::Object)>
+            createBitmap6;
+        impl::StaticMethodId<jni::Object(jni::Object, int32_t, int32_t,
+                                         jni::Object, bool)>
+            createBitmap7;
+        impl::StaticMethodId<jni::Object(jni::Object, int32_t, int32_t,
+                                         jni::Object, bool, jni::Object)>
+            createBitmap8;
+        impl::StaticMethodId<jni::Object(jni::Array<int32_t>, int32_t, int32_t,
+                                         int32_t, int32_t, jni::Object)>
+            createBitmap9;
+        impl::StaticMethodId<jni::Object(jni::Object, jni::Array<int32_t>,
+                                         int32_t, int32_t, int32_t, int32_t,
+                                         jni::Object)>
+            createBitmap10;
+        impl::StaticMethodId<jni::Object(jni::Array<int32_t>, int32_t, int32_t,
+                                         jni::Object)>
+            createBitmap11;
+        impl::StaticMethodId<jni::Object(jni::Object, jni::Array<int32_t>,
+                                         int32_t, int32_t, jni::Object)>
+            createBitmap12;
+        impl::StaticMethodId<jni::Object(jni::Object)> createBitmap13;
+        impl::StaticMethodId<jni::Object(jni::Object, int32_t, int32_t,
+                                         jni::Object)>
+            createBitmap14;
+        impl::MethodId<bool(jni::Object, int32_t, jni::Object)> compress;
+        impl::MethodId<int32_t()> getWidth;
+        impl::MethodId<int32_t()> getHeight;
+        impl::MethodId<int32_t()> getRowBytes;
+        impl::MethodId<int32_t()> getByteCount;
+        impl::MethodId<void(int32_t)> eraseColor;
+        impl::MethodId<void(int64_t)> eraseColor1;
 
         /*!
          * Singleton accessor
@@ -566,18 +663,19 @@ class Paint : public ObjectWrapperBase {
         jni::method_t init;
         jni::method_t init1;
         jni::method_t init2;
-        jni::method_t setAntiAlias;
-        jni::method_t setFilterBitmap;
-        jni::method_t setColor;
-        jni::method_t setColor1;
-        jni::method_t getTextSize;
-        jni::method_t setTextSize;
-        jni::method_t ascent;
-        jni::method_t descent;
-        jni::method_t measureText;
-        jni::method_t measureText1;
-        jni::method_t measureText2;
-        jni::method_t measureText3;
+        impl::MethodId<void(bool)> setAntiAlias;
+        impl::MethodId<void(bool)> setFilterBitmap;
+        impl::MethodId<void(int32_t)> setColor;
+        impl::MethodId<void(int64_t)> setColor1;
+        impl::MethodId<float()> getTextSize;
+        impl::MethodId<void(float)> setTextSize;
+        impl::MethodId<float()> ascent;
+        impl::MethodId<float()> descent;
+        impl::MethodId<float(jni::Array<uint16_t>, int32_t, int32_t)>
+            measureText;
+        impl::MethodId<float(std::string, int32_t, int32_t)> measureText1;
+        impl::MethodId<float(std::string)> measureText2;
+        impl::MethodId<float(jni::Object, int32_t, int32_t)> measureText3;
 
         /*!
          * Singleton accessor
@@ -683,10 +781,16 @@ class Canvas : public ObjectWrapperBase {
     struct Meta : public MetaBaseDroppable {
         jni::method_t init;
         jni::method_t init1;
-        jni::method_t drawText;
-        jni::method_t drawText1;
-        jni::method_t drawText2;
-        jni::method_t drawText3;
+        impl::MethodId<void(jni::Array<uint16_t>, int32_t, int32_t, float,
+                            float, jni::Object)>
+            drawText;
+        impl::MethodId<void(std::string, float, float, jni::Object)> drawText1;
+        impl::MethodId<void(std::string, int32_t, int32_t, float, float,
+                            jni::Object)>
+            drawText2;
+        impl::MethodId<void(jni::Object, int32_t, int32_t, float, float,
+                            jni::Object)>
+            drawText3;
 
         /*!
          * Singleton accessor
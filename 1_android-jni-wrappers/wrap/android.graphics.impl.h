@@ -18,83 +18,93 @@ inline int32_t Point::getY() const {
     assert(!isNull());
     return get(Meta::data().y, object());
 }
+inline void Bitmap::copyPixelsToBuffer(jni::Object &buffer) {
+    assert(!isNull());
+    return Meta::data().copyPixelsToBuffer.call(object(), buffer);
+}
+
+inline void Bitmap::copyPixelsFromBuffer(jni::Object &buffer) {
+    assert(!isNull());
+    return Meta::data().copyPixelsFromBuffer.call(object(), buffer);
+}
+
 inline Bitmap Bitmap::createBitmap(Bitmap &bitmap) {
-    return Bitmap(Meta::data().clazz().call<jni::Object>(
-        Meta::data().createBitmap, bitmap.object()));
+    return Bitmap(Meta::data().createBitmap.call(Meta::data().clazz(),
+                                                 bitmap.object()));
 }
 
 inline Bitmap Bitmap::createBitmap(Bitmap &bitmap, int32_t intParam,
                                    int32_t intParam2, int32_t intParam3,
                                    int32_t intParam4) {
-    return Bitmap(Meta::data().clazz().call<jni::Object>(
-        Meta::data().createBitmap1, bitmap.object(), intParam, intParam2,
-        intParam3, intParam4));
+    return Bitmap(Meta::data().createBitmap1.call(
+        Meta::data().clazz(), bitmap.object(), intParam, intParam2, intParam3,
+        intParam4));
 }
 
 inline Bitmap Bitmap::createBitmap(Bitmap &bitmap, int32_t intParam,
                                    int32_t intParam2, int32_t intParam3,
                                    int32_t intParam4, jni::Object &matrix,
                                    bool booleanParam) {
-    return Bitmap(Meta::data().clazz().call<jni::Object>(
-        Meta::data().createBitmap2, bitmap.object(), intParam, intParam2,
-        intParam3, intParam4, matrix, booleanParam));
+    return Bitmap(Meta::data().createBitmap2.call(
+        Meta::data().clazz(), bitmap.object(), intParam, intParam2, intParam3,
+        intParam4, matrix, booleanParam));
 }
 
 inline Bitmap Bitmap::createBitmap(int32_t intParam, int32_t intParam1,
                                    jni::Object &bitmap_Config) {
-    return Bitmap(Meta::data().clazz().call<jni::Object>(
-        Meta::data().createBitmap3, intParam, intParam1, bitmap_Config));
+    return Bitmap(Meta::data().createBitmap3.call(
+        Meta::data().clazz(), intParam, intParam1, bitmap_Config));
 }
 
 inline Bitmap Bitmap::createBitmap(util::DisplayMetrics &displayMetrics,
                                    int32_t intParam, int32_t intParam2,
                                    jni::Object &bitmap_Config) {
-    return Bitmap(Meta::data().clazz().call<jni::Object>(
-        Meta::data().createBitmap4, displayMetrics.object(), intParam,
-        intParam2, bitmap_Config));
+    return Bitmap(Meta::data().createBitmap4.call(
+        Meta::data().clazz(), displayMetrics.object(), intParam, intParam2,
+        bitmap_Config));
 }
 
 inline Bitmap Bitmap::createBitmap(int32_t intParam, int32_t intParam1,
                                    jni::Object &bitmap_Config,
                                    bool booleanParam) {
-    return Bitmap(Meta::data().clazz().call<jni::Object>(
-        Meta::data().createBitmap5, intParam, intParam1, bitmap_Config,
-        booleanParam));
+    return Bitmap(Meta::data().createBitmap5.call(Meta::data().clazz(),
+                                                  intParam, intParam1,
+                                                  bitmap_Config, booleanParam));
 }
 
 inline Bitmap Bitmap::createBitmap(int32_t intParam, int32_t intParam1,
                                    jni::Object &bitmap_Config,
                                    bool booleanParam, jni::Object &colorSpace) {
-    return Bitmap(Meta::data().clazz().call<jni::Object>(
-        Meta::data().createBitmap6, intParam, intParam1, bitmap_Config,
-        booleanParam, colorSpace));
+    return Bitmap(Meta::data().createBitmap6.call(
+        Meta::data().clazz(), intParam, intParam1, bitmap_Config, booleanParam,
+        colorSpace));
 }
 
 inline Bitmap Bitmap::createBitmap(util::DisplayMetrics &displayMetrics,
                                    int32_t intParam, int32_t intParam2,
                                    jni::Object &bitmap_Config,
                                    bool booleanParam) {
-    return Bitmap(Meta::data().clazz().call<jni::Object>(
-        Meta::data().createBitmap7, displayMetrics.object(), intParam,
-        intParam2, bitmap_Config, booleanParam));
+    return Bitmap(Meta::data().createBitmap7.call(
+        Meta::data().clazz(), displayMetrics.object(), intParam, intParam2,
+        bitmap_Config, booleanParam));
 }
 
 inline Bitmap Bitmap::createBitmap(util::DisplayMetrics &displayMetrics,
                                    int32_t intParam, int32_t intParam2,
                                    jni::Object &bitmap_Config,
                                    bool booleanParam, jni::Object &colorSpace) {
-    return Bitmap(Meta::data().clazz().call<jni::Object>(
-        Meta::data().createBitmap8, displayMetrics.object(), intParam,
-        intParam2, bitmap_Config, booleanParam, colorSpace));
+    return Bitmap(Meta::data().createBitmap8.call(
+        Meta::data().clazz(), displayMetrics.object(), intParam, intParam2,
+        bitmap_Config, booleanParam, colorSpace));
 }
 
 inline Bitmap Bitmap::createBitmap(jni::Array<int32_t> &intParamArray,
                                    int32_t intParam, int32_t intParam2,
                                    int32_t intParam3, int32_t intParam4,
                                    jni::Object &bitmap_Config) {
-    return Bitmap(Meta::data().clazz().call<jni::Object>(
-        Meta::data().createBitmap9, intParamArray, intParam, intParam2,
-        intParam3, intParam4, bitmap_Config));
+    return Bitmap(Meta::data().createBitmap9.call(
+        Meta::data().clazz(), intParamArray, intParam, intParam2, intParam3,
+        intParam4, bitmap_Config));
 }
 
 inline Bitmap Bitmap::createBitmap(util::DisplayMetrics &displayMetrics,
@@ -102,56 +112,75 @@ inline Bitmap Bitmap::createBitmap(util::DisplayMetrics &displayMetrics,
                                    int32_t intParam, int32_t intParam3,
                                    int32_t intParam4, int32_t intParam5,
                                    jni::Object &bitmap_Config) {
-    return Bitmap(Meta::data().clazz().call<jni::Object>(
-        Meta::data().createBitmap10, displayMetrics.object(), intParamArray,
-        intParam, intParam3, intParam4, intParam5, bitmap_Config));
+    return Bitmap(Meta::data().createBitmap10.call(
+        Meta::data().clazz(), displayMetrics.object(), intParamArray, intParam,
+        intParam3, intParam4, intParam5, bitmap_Config));
 }
 
 inline Bitmap Bitmap::createBitmap(jni::Array<int32_t> &intParamArray,
                                    int32_t intParam, int32_t intParam2,
                                    jni::Object &bitmap_Config) {
-    return Bitmap(Meta::data().clazz().call<jni::Object>(
-        Meta::data().createBitmap11, intParamArray, intParam, intParam2,
-        bitmap_Config));
+    return Bitmap(Meta::data().createBitmap11.call(Meta::data().clazz(),
+                                                   intParamArray, intParam,
+                                                   intParam2, bitmap_Config));
 }
 
 inline Bitmap Bitmap::createBitmap(util::DisplayMetrics &displayMetrics,
                                    jni::Array<int32_t> &intParamArray,
                                    int32_t intParam, int32_t intParam3,
                                    jni::Object &bitmap_Config) {
-    return Bitmap(Meta::data().clazz().call<jni::Object>(
-        Meta::data().createBitmap12, displayMetrics.object(), intParamArray,
-        intParam, intParam3, bitmap_Config));
+    return Bitmap(Meta::data().createBitmap12.call(
+        Meta::data().clazz(), displayMetrics.object(), intParamArray, intParam,
+        intParam3, bitmap_Config));
 }
 
 inline Bitmap Bitmap::createBitmap(jni::Object &picture) {
-    return Bitmap(Meta::data().clazz().call<jni::Object>(
-        Meta::data().createBitmap13, picture));
+    return Bitmap(Meta::data().createBitmap13.call(Meta::data().clazz(),
+                                                   picture));
 }
 
 inline Bitmap Bitmap::createBitmap(jni::Object &picture, int32_t intParam,
                                    int32_t intParam2,
                                    jni::Object &bitmap_Config) {
-    return Bitmap(Meta::data().clazz().call<jni::Object>(
-        Meta::data().createBitmap14, picture, intParam, intParam2,
-        bitmap_Config));
+    return Bitmap(Meta::data().createBitmap14.call(
+        Meta::data().clazz(), picture, intParam, intParam2, bitmap_Config));
 }
 
 inline bool Bitmap::compress(jni::Object &bitmap_CompressFormat,
                              int32_t intParam, jni::Object &outputStream) {
     assert(!isNull());
-    return object().call<bool>(Meta::data().compress, bitmap_CompressFormat,
-                               intParam, outputStream);
+    return Meta::data().compress.call(object(), bitmap_CompressFormat, intParam,
+                                      outputStream);
+}
+
+inline int32_t Bitmap::getWidth() {
+    assert(!isNull());
+    return Meta::data().getWidth.call(object());
+}
+
+inline int32_t Bitmap::getHeight() {
+    assert(!isNull());
+    return Meta::data().getHeight.call(object());
+}
+
+inline int32_t Bitmap::getRowBytes() {
+    assert(!isNull());
+    return Meta::data().getRowBytes.call(object());
+}
+
+inline int32_t Bitmap::getByteCount() {
+    assert(!isNull());
+    return Meta::data().getByteCount.call(object());
 }
 
 inline void Bitmap::eraseColor(int32_t intParam) {
     assert(!isNull());
-    return object().call<void>(Meta::data().eraseColor, intParam);
+    return Meta::data().eraseColor.call(object(), intParam);
 }
 
 inline void Bitmap::eraseColor(int64_t longParam) {
     assert(!isNull());
-    return object().call<void>(Meta::data().eraseColor1, longParam);
+    return Meta::data().eraseColor1.call(object(), longParam);
 }
 inline Paint Paint::construct() {
     return Paint(Meta::data().clazz().newInstance(Meta::data().init));
@@ -169,68 +198,68 @@ inline Paint Paint::construct(Paint &paint) {
 
 inline void Paint::setAntiAlias(bool booleanParam) {
     assert(!isNull());
-    return object().call<void>(Meta::data().setAntiAlias, booleanParam);
+    return Meta::data().setAntiAlias.call(object(), booleanParam);
 }
 
 inline void Paint::setFilterBitmap(bool booleanParam) {
     assert(!isNull());
-    return object().call<void>(Meta::data().setFilterBitmap, booleanParam);
+    return Meta::data().setFilterBitmap.call(object(), booleanParam);
 }
 
 inline void Paint::setColor(int32_t intParam) {
     assert(!isNull());
-    return object().call<void>(Meta::data().setColor, intParam);
+    return Meta::data().setColor.call(object(), intParam);
 }
 
 inline void Paint::setColor(int64_t longParam) {
     assert(!isNull());
-    return object().call<void>(Meta::data().setColor1, longParam);
+    return Meta::data().setColor1.call(object(), longParam);
 }
 
 inline float Paint::getTextSize() {
     assert(!isNull());
-    return object().call<float>(Meta::data().getTextSize);
+    return Meta::data().getTextSize.call(object());
 }
 
 inline void Paint::setTextSize(float floatParam) {
     assert(!isNull());
-    return object().call<void>(Meta::data().setTextSize, floatParam);
+    return Meta::data().setTextSize.call(object(), floatParam);
 }
 
 inline float Paint::ascent() {
     assert(!isNull());
-    return object().call<float>(Meta::data().ascent);
+    return Meta::data().ascent.call(object());
 }
 
 inline float Paint::descent() {
     assert(!isNull());
-    return object().call<float>(Meta::data().descent);
+    return Meta::data().descent.call(object());
 }
 
 inline float Paint::measureText(jni::Array<uint16_t> &charParamArray,
                                 int32_t intParam, int32_t intParam2) {
     assert(!isNull());
-    return object().call<float>(Meta::data().measureText, charParamArray,
-                                intParam, intParam2);
+    return Meta::data().measureText.call(object(), charParamArray, intParam,
+                                         intParam2);
 }
 
 inline float Paint::measureText(std::string &stringParam, int32_t intParam,
                                 int32_t intParam2) {
     assert(!isNull());
-    return object().call<float>(Meta::data().measureText1, stringParam,
-                                intParam, intParam2);
+    return Meta::data().measureText1.call(object(), stringParam, intParam,
+                                          intParam2);
 }
 
 inline float Paint::measureText(std::string &stringParam) {
     assert(!isNull());
-    return object().call<float>(Meta::data().measureText2, stringParam);
+    return Meta::data().measureText2.call(object(), stringParam);
 }
 
 inline float Paint::measureText(jni::Object &charSequence, int32_t intParam,
                                 int32_t intParam2) {
     assert(!isNull());
-    return object().call<float>(Meta::data().measureText3, charSequence,
-                                intParam, intParam2);
+    return Meta::data().measureText3.call(object(), charSequence, intParam,
+                                          intParam2);
 }
 inline Canvas Canvas::construct() {
     return Canvas(Meta::data().clazz().newInstance(Meta::data().init));
@@ -246,34 +275,34 @@ inline void Canvas::drawText(jni::Array<uint16_t> &charParamArray,
                              float floatParam, float floatParam4,
                              Paint &paint) {
     assert(!isNull());
-    return object().call<void>(Meta::data().drawText, charParamArray, intParam,
-                               intParam2, floatParam, floatParam4,
-                               paint.object());
+    return Meta::data().drawText.call(object(), charParamArray, intParam,
+                                      intParam2, floatParam, floatParam4,
+                                      paint.object());
 }
 
 inline void Canvas::drawText(std::string &stringParam, float floatParam,
                              float floatParam2, Paint &paint) {
     assert(!isNull());
-    return object().call<void>(Meta::data().drawText1, stringParam, floatParam,
-                               floatParam2, paint.object());
+    return Meta::data().drawText1.call(object(), stringParam, floatParam,
+                                       floatParam2, paint.object());
 }
 
 inline void Canvas::drawText(std::string &stringParam, int32_t intParam,
                              int32_t intParam2, float floatParam,
                              float floatParam4, Paint &paint) {
     assert(!isNull());
-    return object().call<void>(Meta::data().drawText2, stringParam, intParam,
-                               intParam2, floatParam, floatParam4,
-                               paint.object());
+    return Meta::data().drawText2.call(object(), stringParam, intParam,
+                                       intParam2, floatParam, floatParam4,
+                                       paint.object());
 }
 
 inline void Canvas::drawText(jni::Object &charSequence, int32_t intParam,
                              int32_t intParam2, float floatParam,
                              float floatParam4, Paint &paint) {
     assert(!isNull());
-    return object().call<void>(Meta::data().drawText3, charSequence, intParam,
-                               intParam2, floatParam, floatParam4,
-                               paint.object());
+    return Meta::data().drawText3.call(object(), charSequence, intParam,
+                                       intParam2, floatParam, floatParam4,
+                                       paint.object());
 }
 inline int32_t Color::BLACK() {
     return get(Meta::data().BLACK, Meta::data().clazz());
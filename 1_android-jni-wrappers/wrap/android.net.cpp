@@ -12,13 +12,13 @@ Uri::Meta::Meta() : MetaBaseDroppable(Uri::getTypeName()) {
 Uri_Builder::Meta::Meta()
     : MetaBaseDroppable(Uri_Builder::getTypeName()),
       init(classRef().getMethod("<init>", "()V")),
-      scheme(classRef().getMethod(
-          "scheme", "(Ljava/lang/String;)Landroid/net/Uri$Builder;")),
-      authority(classRef().getMethod(
-          "authority", "(Ljava/lang/String;)Landroid/net/Uri$Builder;")),
-      appendPath(classRef().getMethod(
-          "appendPath", "(Ljava/lang/String;)Landroid/net/Uri$Builder;")),
-      build(classRef().getMethod("build", "()Landroid/net/Uri;")) {
+      scheme(classRef(), "scheme",
+             "(Ljava/lang/String;)Landroid/net/Uri$Builder;"),
+      authority(classRef(), "authority",
+                "(Ljava/lang/String;)Landroid/net/Uri$Builder;"),
+      appendPath(classRef(), "appendPath",
+                 "(Ljava/lang/String;)Landroid/net/Uri$Builder;"),
+      build(classRef(), "build", "()Landroid/net/Uri;") {
     MetaBaseDroppable::dropClassRef();
 }
 } // namespace android::net
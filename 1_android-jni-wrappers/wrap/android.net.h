@@ -113,10 +113,10 @@ class Uri_Builder : public ObjectWrapperBase {
      */
     struct Meta : public MetaBaseDroppable {
         jni::method_t init;
-        jni::method_t scheme;
-        jni::method_t authority;
-        jni::method_t appendPath;
-        jni::method_t build;
+        impl::MethodId<jni::Object(std::string)> scheme;
+        impl::MethodId<jni::Object(std::string)> authority;
+        impl::MethodId<jni::Object(std::string)> appendPath;
+        impl::MethodId<jni::Object()> build;
 
         /*!
          * Singleton accessor
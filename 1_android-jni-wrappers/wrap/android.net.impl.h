@@ -15,25 +15,22 @@ inline Uri_Builder Uri_Builder::construct() {
 
 inline Uri_Builder Uri_Builder::scheme(std::string &stringParam) {
     assert(!isNull());
-    return Uri_Builder(
-        object().call<jni::Object>(Meta::data().scheme, stringParam));
+    return Uri_Builder(Meta::data().scheme.call(object(), stringParam));
 }
 
 inline Uri_Builder Uri_Builder::authority(std::string &stringParam) {
     assert(!isNull());
-    return Uri_Builder(
-        object().call<jni::Object>(Meta::data().authority, stringParam));
+    return Uri_Builder(Meta::data().authority.call(object(), stringParam));
 }
 
 inline Uri_Builder Uri_Builder::appendPath(std::string &stringParam) {
     assert(!isNull());
-    return Uri_Builder(
-        object().call<jni::Object>(Meta::data().appendPath, stringParam));
+    return Uri_Builder(Meta::data().appendPath.call(object(), stringParam));
 }
 
 inline Uri Uri_Builder::build() {
     assert(!isNull());
-    return Uri(object().call<jni::Object>(Meta::data().build));
+    return Uri(Meta::data().build.call(object()));
 }
 } // namespace android::net
 } // namespace wrap
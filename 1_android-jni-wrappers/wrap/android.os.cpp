@@ -8,12 +8,13 @@ namespace wrap {
 namespace android::os {
 BaseBundle::Meta::Meta()
     : MetaBaseDroppable(BaseBundle::getTypeName()),
-      containsKey(classRef().getMethod("containsKey", "(Ljava/lang/String;)Z")),
-      getString(classRef().getMethod("getString",
-                                     "(Ljava/lang/String;)Ljava/lang/String;")),
-      getString1(classRef().getMethod(
-          "getString",
-          "(Ljava/lang/String;Ljava/lang/String;)Ljava/lang/String;")) {
+      containsKey(classRef(), "containsKey", "(Ljava/lang/String;)Z"),
+      get(classRef(), "get", "(Ljava/lang/String;)Ljava/lang/Object;"),
+      keySet(classRef(), "keySet", "()Ljava/util/Set;"),
+      getString(classRef(), "getString",
+                "(Ljava/lang/String;)Ljava/lang/String;"),
+      getString1(classRef(), "getString",
+                 "(Ljava/lang/String;Ljava/lang/String;)Ljava/lang/String;") {
     MetaBaseDroppable::dropClassRef();
 }
 Bundle::Meta::Meta() : MetaBaseDroppable(Bundle::getTypeName()) {
@@ -21,12 +22,11 @@ Bundle::Meta::Meta() : MetaBaseDroppable(Bundle::getTypeName()) {
 }
 ParcelFileDescriptor::Meta::Meta()
     : MetaBaseDroppable(ParcelFileDescriptor::getTypeName()),
-      adoptFd(classRef().getStaticMethod(
-          "adoptFd", "(I)Landroid/os/ParcelFileDescriptor;")),
-      getFd(classRef().getMethod("getFd", "()I")),
-      detachFd(classRef().getMethod("detachFd", "()I")),
-      close(classRef().getMethod("close", "()V")),
-      checkError(classRef().getMethod("checkError", "()V")) {
+      adoptFd(classRef(), "adoptFd", "(I)Landroid/os/ParcelFileDescriptor;"),
+      getFd(classRef(), "getFd", "()I"),
+      detachFd(classRef(), "detachFd", "()I"),
+      close(classRef(), "close", "()V"),
+      checkError(classRef(), "checkError", "()V") {
     MetaBaseDroppable::dropClassRef();
 }
 } // namespace android::os
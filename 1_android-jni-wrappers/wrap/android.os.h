@@ -36,6 +36,28 @@ class BaseBundle : public ObjectWrapperBase {
      */
     bool containsKey(std::string &stringParam);
 
+    /*!
+     * Wrapper for the get method
+     *
+     * Java prototype:
+     * `public java.lang.Object get(java.lang.String);`
+     *
+     * JNI signature: (Ljava/lang/String;)Ljava/lang/Object;
+     *
+     */
+    jni::Object get(std::string &stringParam);
+
+    /*!
+     * Wrapper for the keySet method
+     *
+     * Java prototype:
+     * `public java.util.Set<java.lang.String> keySet();`
+     *
+     * JNI signature: ()Ljava/util/Set;
+     *
+     */
+    jni::Object keySet();
+
     /*!
      * Wrapper for the getString method
      *
@@ -62,9 +84,11 @@ class BaseBundle : public ObjectWrapperBase {
      * Class metadata
      */
     struct Meta : public MetaBaseDroppable {
-        jni::method_t containsKey;
-        jni::method_t getString;
-        jni::method_t getString1;
+        impl::MethodId<bool(std::string)> containsKey;
+        impl::MethodId<jni::Object(std::string)> get;
+        impl::MethodId<jni::Object()> keySet;
+        impl::MethodId<std::string(std::string)> getString;
+        impl::MethodId<std::string(std::string, std::string)> getString1;
 
         /*!
          * Singleton accessor
@@ -174,11 +198,11 @@ class ParcelFileDescriptor : public ObjectWrapperBase {
      * Class metadata
      */
     struct Meta : public MetaBaseDroppable {
-        jni::method_t adoptFd;
-        jni::method_t getFd;
-        jni::method_t detachFd;
-        jni::method_t close;
-        jni::method_t checkError;
+        impl::StaticMethodId<jni::Object(int32_t)> adoptFd;
+        impl::MethodId<int32_t()> getFd;
+        impl::MethodId<int32_t()> detachFd;
+        impl::MethodId<void()> close;
+        impl::MethodId<void()> checkError;
 
         /*!
          * Singleton accessor
@@ -10,44 +10,53 @@ namespace wrap {
 namespace android::os {
 inline bool BaseBundle::containsKey(std::string &stringParam) {
     assert(!isNull());
-    return object().call<bool>(Meta::data().containsKey, stringParam);
+    return Meta::data().containsKey.call(object(), stringParam);
+}
+
+inline jni::Object BaseBundle::get(std::string &stringParam) {
+    assert(!isNull());
+    return Meta::data().get.call(object(), stringParam);
+}
+
+inline jni::Object BaseBundle::keySet() {
+    assert(!isNull());
+    return Meta::data().keySet.call(object());
 }
 
 inline std::string BaseBundle::getString(std::string &stringParam) {
     assert(!isNull());
-    return object().call<std::string>(Meta::data().getString, stringParam);
+    return Meta::data().getString.call(object(), stringParam);
 }
 
 inline std::string BaseBundle::getString(std::string &stringParam,
                                          std::string &stringParam1) {
     assert(!isNull());
-    return object().call<std::string>(Meta::data().getString1, stringParam,
-                                      stringParam1);
+    return Meta::data().getString1.call(object(), stringParam, stringParam1);
 }
 
 inline ParcelFileDescriptor ParcelFileDescriptor::adoptFd(int32_t intParam) {
-    return ParcelFileDescriptor(
-        Meta::data().clazz().call<jni::Object>(Meta::data().adoptFd, intParam));
+    return ParcelFileDescriptor(Meta::data().adoptFd.call(Meta::data().clazz(),
+                                                          intParam));
 }
 
 inline int32_t ParcelFileDescriptor::getFd() {
     assert(!isNull());
-    return object().call<int32_t>(Meta::data().getFd);
+    return Meta::data().getFd.call(object());
 }
 
 inline int32_t ParcelFileDescriptor::detachFd() {
     assert(!isNull());
-    return object().call<int32_t>(Meta::data().detachFd);
+    return Meta::data().detachFd.call(object());
 }
 
 inline void ParcelFileDescriptor::close() {
     assert(!isNull());
-    return object().call<void>(Meta::data().close);
+    return Meta::data().close.call(object());
 }
 
 inline void ParcelFileDescriptor::checkError() {
     assert(!isNull());
-    return object().call<void>(Meta::data().checkError);
+    return Meta::data().checkError.call(object());
 }
 } // namespace android::os
 } // namespace wrap
@@ -8,8 +8,8 @@ namespace wrap {
 namespace android::service::vr {
 VrListenerService::Meta::Meta()
     : MetaBase(VrListenerService::getTypeName()),
-      isVrModePackageEnabled(classRef().getStaticMethod(
-          "isVrModePackageEnabled",
-          "(Landroid/content/Context;Landroid/content/ComponentName;)Z")) {}
+      isVrModePackageEnabled(classRef(), "isVrModePackageEnabled",
+                             "(Landroid/content/Context;Landroid/content/"
+                             "ComponentName;)Z") {}
 } // namespace android::service::vr
 } // namespace wrap
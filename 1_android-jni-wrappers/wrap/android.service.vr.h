@@ -45,7 +45,8 @@ class VrListenerService : public app::Service {
      * Class metadata
      */
     struct Meta : public MetaBase {
-        jni::method_t isVrModePackageEnabled;
+        impl::StaticMethodId<bool(jni::Object, jni::Object)>
+            isVrModePackageEnabled;
 
         /*!
          * Singleton accessor
@@ -10,9 +10,8 @@ namespace wrap {
 namespace android::service::vr {
 inline bool VrListenerService::isVrModePackageEnabled(
     content::Context &context, content::ComponentName &componentName) {
-    return Meta::data().clazz().call<bool>(Meta::data().isVrModePackageEnabled,
-                                           context.object(),
-                                           componentName.object());
+    return Meta::data().isVrModePackageEnabled.call(
+        Meta::data().clazz(), context.object(), componentName.object());
 }
 } // namespace android::service::vr
 } // namespace wrap
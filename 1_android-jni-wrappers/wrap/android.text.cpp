@@ -8,15 +8,13 @@ namespace wrap {
 namespace android::text {
 TextUtils::Meta::Meta()
     : MetaBaseDroppable(TextUtils::getTypeName()),
-      ellipsize(classRef().getStaticMethod(
-          "ellipsize",
-          "(Ljava/lang/CharSequence;Landroid/text/TextPaint;FLandroid/text/"
-          "TextUtils$TruncateAt;)Ljava/lang/CharSequence;")),
-      ellipsize1(classRef().getStaticMethod(
-          "ellipsize",
-          "(Ljava/lang/CharSequence;Landroid/text/TextPaint;FLandroid/text/"
-          "TextUtils$TruncateAt;ZLandroid/text/"
-          "TextUtils$EllipsizeCallback;)Ljava/lang/CharSequence;")) {
+      ellipsize(classRef(), "ellipsize",
+                "(Ljava/lang/CharSequence;Landroid/text/TextPaint;FLandroid/"
+                "text/TextUtils$TruncateAt;)Ljava/lang/CharSequence;"),
+      ellipsize1(classRef(), "ellipsize",
+                 "(Ljava/lang/CharSequence;Landroid/text/TextPaint;"
+                 "FLandroid/text/TextUtils$TruncateAt;ZLandroid/text/"
+                 "TextUtils$EllipsizeCallback;)Ljava/lang/CharSequence;") {
     MetaBaseDroppable::dropClassRef();
 }
 } // namespace android::text
@@ -55,8 +55,12 @@ class TextUtils : public ObjectWrapperBase {
      * Class metadata
      */
     struct Meta : public MetaBaseDroppable {
-        jni::method_t ellipsize;
-        jni::method_t ellipsize1;
+        impl::StaticMethodId<jni::Object(jni::Object, jni::Object, float,
+                                         jni::Object)>
+            ellipsize;
+        impl::StaticMethodId<jni::Object(jni::Object, jni::Object, float,
+                                         jni::Object, bool, jni::Object)>
+            ellipsize1;
 
         /*!
          * Singleton accessor
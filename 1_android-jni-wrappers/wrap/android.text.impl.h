@@ -10,9 +10,9 @@ inline jni::Object TextUtils::ellipsize(jni::Object &charSequence,
                                         jni::Object &textPaint,
                                         float floatParam,
                                         jni::Object &textUtils_TruncateAt) {
-    return Meta::data().clazz().call<jni::Object>(
-        Meta::data().ellipsize, charSequence, textPaint, floatParam,
-        textUtils_TruncateAt);
+    return Meta::data().ellipsize.call(Meta::data().clazz(), charSequence,
+                                       textPaint, floatParam,
+                                       textUtils_TruncateAt);
 }
 
 inline jni::Object
@@ -20,8 +20,8 @@ TextUtils::ellipsize(jni::Object &charSequence, jni::Object &textPaint,
                      float floatParam, jni::Object &textUtils_TruncateAt,
                      bool booleanParam,
                      jni::Object &textUtils_EllipsizeCallback) {
-    return Meta::data().clazz().call<jni::Object>(
-        Meta::data().ellipsize1, charSequence, textPaint, floatParam,
+    return Meta::data().ellipsize1.call(
+        Meta::data().clazz(), charSequence, textPaint, floatParam,
         textUtils_TruncateAt, booleanParam, textUtils_EllipsizeCallback);
 }
 } // namespace android::text
@@ -8,21 +8,19 @@ namespace wrap {
 namespace android::view {
 Display::Meta::Meta()
     : MetaBaseDroppable(Display::getTypeName()),
-      getRealSize(
-          classRef().getMethod("getRealSize", "(Landroid/graphics/Point;)V")),
-      getRealMetrics(classRef().getMethod("getRealMetrics",
-                                          "(Landroid/util/DisplayMetrics;)V")) {
+      getRealSize(classRef(), "getRealSize", "(Landroid/graphics/Point;)V"),
+      getRealMetrics(classRef(), "getRealMetrics",
+                     "(Landroid/util/DisplayMetrics;)V") {
     MetaBaseDroppable::dropClassRef();
 }
 Surface::Meta::Meta()
     : MetaBaseDroppable(Surface::getTypeName()),
-      isValid(classRef().getMethod("isValid", "()Z")) {
+      isValid(classRef(), "isValid", "()Z") {
     MetaBaseDroppable::dropClassRef();
 }
 SurfaceHolder::Meta::Meta()
     : MetaBaseDroppable(SurfaceHolder::getTypeName()),
-      getSurface(
-          classRef().getMethod("getSurface", "()Landroid/view/Surface;")) {
+      getSurface(classRef(), "getSurface", "()Landroid/view/Surface;") {
     MetaBaseDroppable::dropClassRef();
 }
 } // namespace android::view
@@ -59,8 +59,8 @@ class Display : public ObjectWrapperBase {
      * Class metadata
      */
     struct Meta : public MetaBaseDroppable {
-        jni::method_t getRealSize;
-        jni::method_t getRealMetrics;
+        impl::MethodId<void(jni::Object)> getRealSize;
+        impl::MethodId<void(jni::Object)> getRealMetrics;
 
         /*!
          * Singleton accessor
@@ -99,7 +99,7 @@ class Surface : public ObjectWrapperBase {
      * Class metadata
      */
     struct Meta : public MetaBaseDroppable {
-        jni::method_t isValid;
+        impl::MethodId<bool()> isValid;
 
         /*!
          * Singleton accessor
@@ -138,7 +138,7 @@ class SurfaceHolder : public ObjectWrapperBase {
      * Class metadata
      */
     struct Meta : public MetaBaseDroppable {
-        jni::method_t getSurface;
+        impl::MethodId<jni::Object()> getSurface;
 
         /*!
          * Singleton accessor
@@ -11,21 +11,20 @@ namespace wrap {
 namespace android::view {
 inline void Display::getRealSize(graphics::Point &point) {
     assert(!isNull());
-    return object().call<void>(Meta::data().getRealSize, point.object());
+    return Meta::data().getRealSize.call(object(), point.object());
 }
 
 inline void Display::getRealMetrics(util::DisplayMetrics &displayMetrics) {
     assert(!isNull());
-    return object().call<void>(Meta::data().getRealMetrics,
-                               displayMetrics.object());
+    return Meta::data().getRealMetrics.call(object(), displayMetrics.object());
 }
 inline bool Surface::isValid() {
     assert(!isNull());
-    return object().call<bool>(Meta::data().isValid);
+    return Meta::data().isValid.call(object());
 }
 inline Surface SurfaceHolder::getSurface() {
     assert(!isNull());
-    return Surface(object().call<jni::Object>(Meta::data().getSurface));
+    return Surface(Meta::data().getSurface.call(object()));
 }
 } // namespace android::view
 } // namespace wrap
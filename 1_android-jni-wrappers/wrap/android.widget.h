@@ -95,9 +95,11 @@ class Toast : public ObjectWrapperBase {
     struct Meta : public MetaBase {
         impl::StaticFieldId<int32_t> LENGTH_LONG;
         impl::StaticFieldId<int32_t> LENGTH_SHORT;
-        jni::method_t show;
-        jni::method_t makeText;
-        jni::method_t makeText1;
+        impl::MethodId<void()> show;
+        impl::StaticMethodId<jni::Object(jni::Object, jni::Object, int32_t)>
+            makeText;
+        impl::StaticMethodId<jni::Object(jni::Object, int32_t, int32_t)>
+            makeText1;
 
         /*!
          * Singleton accessor
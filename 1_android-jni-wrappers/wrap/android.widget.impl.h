@@ -18,19 +18,19 @@ inline int32_t Toast::LENGTH_SHORT() {
 
 inline void Toast::show() {
     assert(!isNull());
-    return object().call<void>(Meta::data().show);
+    return Meta::data().show.call(object());
 }
 
 inline Toast Toast::makeText(content::Context &context,
                              jni::Object &charSequence, int32_t intParam) {
-    return Toast(Meta::data().clazz().call<jni::Object>(
-        Meta::data().makeText, context.object(), charSequence, intParam));
+    return Toast(Meta::data().makeText.call(
+        Meta::data().clazz(), context.object(), charSequence, intParam));
 }
 
 inline Toast Toast::makeText(content::Context &context, int32_t intParam,
                              int32_t intParam2) {
-    return Toast(Meta::data().clazz().call<jni::Object>(
-        Meta::data().makeText1, context.object(), intParam, intParam2));
+    return Toast(Meta::data().makeText1.call(
+        Meta::data().clazz(), context.object(), intParam, intParam2));
 }
 } // namespace android::widget
 } // namespace wrap
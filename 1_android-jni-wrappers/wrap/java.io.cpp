@@ -14,8 +14,18 @@ File::Meta::Meta()
       init2(classRef().getMethod("<init>",
                                  "(Ljava/io/File;Ljava/lang/String;)V")),
       init3(classRef().getMethod("<init>", "(Ljava/net/URI;)V")),
-      exists(classRef().getMethod("exists", "()Z")),
-      mkdirs(classRef().getMethod("mkdirs", "()Z")) {
+      getAbsolutePath(classRef(), "getAbsolutePath", "()Ljava/lang/String;"),
+      exists(classRef(), "exists", "()Z"),
+      mkdirs(classRef(), "mkdirs", "()Z") {
+    MetaBaseDroppable::dropClassRef();
+}
+OutputStream::Meta::Meta()
+    : MetaBaseDroppable(OutputStream::getTypeName()),
+      write(classRef(), "write", "(I)V"),
+      write1(classRef(), "write", "([B)V"),
+      write2(classRef(), "write", "([BII)V"),
+      flush(classRef(), "flush", "()V"),
+      close(classRef(), "close", "()V") {
     MetaBaseDroppable::dropClassRef();
 }
 FileOutputStream::Meta::Meta()
@@ -25,7 +35,15 @@ FileOutputStream::Meta::Meta()
       init2(classRef().getMethod("<init>", "(Ljava/io/File;)V")),
       init3(classRef().getMethod("<init>", "(Ljava/io/File;Z)V")),
       init4(classRef().getMethod("<init>", "(Ljava/io/FileDescriptor;)V")),
-      close(classRef().getMethod("close", "()V")) {
+      close(classRef(), "close", "()V") {
+    MetaBaseDroppable::dropClassRef();
+}
+InputStream::Meta::Meta()
+    : MetaBaseDroppable(InputStream::getTypeName()),
+      read(classRef(), "read", "()I"), read1(classRef(), "read", "([B)I"),
+      read2(classRef(), "read", "([BII)I"), skip(classRef(), "skip", "(J)J"),
+      available(classRef(), "available", "()I"),
+      close(classRef(), "close", "()V") {
     MetaBaseDroppable::dropClassRef();
 }
 } // namespace java::io
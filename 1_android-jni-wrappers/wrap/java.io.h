@@ -10,6 +10,7 @@ namespace wrap {
 namespace java::io {
 class File;
 class FileOutputStream;
+class InputStream;
 } // namespace java::io
 
 } // namespace wrap
@@ -70,6 +71,17 @@ class File : public ObjectWrapperBase {
      */
     static File construct(jni::Object &uRI);
 
+    /*!
+     * Wrapper for the getAbsolutePath method
+     *
+     * Java prototype:
+     * `public java.lang.String getAbsolutePath();`
+     *
+     * JNI signature: ()Ljava/lang/String;
+     *
+     */
+    std::string getAbsolutePath();
+
     /*!
      * Wrapper for the exists method
      *
@@ -100,8 +112,9 @@ class File : public ObjectWrapperBase {
         jni::method_t init1;
         jni::method_t init2;
         jni::method_t init3;
-        jni::method_t exists;
-        jni::method_t mkdirs;
+        impl::MethodId<std::string()> getAbsolutePath;
+        impl::MethodId<bool()> exists;
+        impl::MethodId<bool()> mkdirs;
 
         /*!
          * Singleton accessor
@@ -116,11 +129,99 @@ class File : public ObjectWrapperBase {
     };
 };
 /*!
- * Wrapper for java.io.FileOutputStream objects.
+ * Wrapper for java.io.OutputStream objects.
  */
-class FileOutputStream : public ObjectWrapperBase {
+class OutputStream : public ObjectWrapperBase {
   public:
     using ObjectWrapperBase::ObjectWrapperBase;
+    static constexpr const char *getTypeName() noexcept {
+        return "java/io/OutputStream";
+    }
+
+    /*!
+     * Wrapper for the write method
+     *
+     * Java prototype:
+     * `public abstract void write(int) throws java.io.IOException;`
+     *
+     * JNI signature: (I)V
+     *
+     */
+    void write(int32_t intParam);
+
+    /*!
+     * Wrapper for the write method
+     *
+     * Java prototype:
+     * `public void write(byte[]) throws java.io.IOException;`
+     *
+     * JNI signature: ([B)V
+     *
+     */
+    void write(jni::Array<jni::byte_t> &byteParamArray);
+
+    /*!
+     * Wrapper for the write method
+     *
+     * Java prototype:
+     * `public void write(byte[], int, int) throws java.io.IOException;`
+     *
+     * JNI signature: ([BII)V
+     *
+     */
+    void write(jni::Array<jni::byte_t> &byteParamArray, int32_t intParam,
+               int32_t intParam1);
+
+    /*!
+     * Wrapper for the flush method
+     *
+     * Java prototype:
+     * `public void flush() throws java.io.IOException;`
+     *
+     * JNI signature: ()V
+     *
+     */
+    void flush();
+
+    /*!
+     * Wrapper for the close method
+     *
+     * Java prototype:
+     * `public void close() throws java.io.IOException;`
+     *
+     * JNI signature: ()V
+     *
+     */
+    void close();
+
+    /*!
+     * Class metadata
+     */
+    struct Meta : public MetaBaseDroppable {
+        impl::MethodId<void(int32_t)> write;
+        impl::MethodId<void(jni::Array<jni::byte_t>)> write1;
+        impl::MethodId<void(jni::Array<jni::byte_t>, int32_t, int32_t)> write2;
+        impl::MethodId<void()> flush;
+        impl::MethodId<void()> close;
+
+        /*!
+         * Singleton accessor
+         */
+        static Meta &data() {
+            static Meta instance{};
+            return instance;
+        }
+
+      private:
+        Meta();
+    };
+};
+/*!
+ * Wrapper for java.io.FileOutputStream objects.
+ */
+class FileOutputStream : public OutputStream {
+  public:
+    using OutputStream::OutputStream;
     static constexpr const char *getTypeName() noexcept {
         return "java/io/FileOutputStream";
     }
@@ -205,7 +306,108 @@ class FileOutputStream : public ObjectWrapperBase {
         jni::method_t init2;
         jni::method_t init3;
         jni::method_t init4;
-        jni::method_t close;
+        impl::MethodId<void()> close;
+
+        /*!
+         * Singleton accessor
+         */
+        static Meta &data() {
+            static Meta instance{};
+            return instance;
+        }
+
+      private:
+        Meta();
+    };
+};
+/*!
+ * Wrapper for java.io.InputStream objects.
+ */
+class InputStream : public ObjectWrapperBase {
+  public:
+    using ObjectWrapperBase::ObjectWrapperBase;
+    static constexpr const char *getTypeName() noexcept {
+        return "java/io/InputStream";
+    }
+
+    /*!
+     * Wrapper for the read method
+     *
+     * Java prototype:
+     * `public abstract int read() throws java.io.IOException;`
+     *
+     * JNI signature: ()I
+     *
+     */
+    int32_t read();
+
+    /*!
+     * Wrapper for the read method
+     *
+     * Java prototype:
+     * `public int read(byte[]) throws java.io.IOException;`
+     *
+     * JNI signature: ([B)I
+     *
+     */
+    int32_t read(jni::Array<jni::byte_t> &byteParamArray);
+
+    /*!
+     * Wrapper for the read method
+     *
+     * Java prototype:
+     * `public int read(byte[], int, int) throws java.io.IOException;`
+     *
+     * JNI signature: ([BII)I
+     *
+     */
+    int32_t read(jni::Array<jni::byte_t> &byteParamArray, int32_t intParam,
+                 int32_t intParam1);
+
+    /*!
+     * Wrapper for the skip method
+     *
+     * Java prototype:
+     * `public long skip(long) throws java.io.IOException;`
+     *
+     * JNI signature: (J)J
+     *
+     */
+    int64_t skip(int64_t longParam);
+
+    /*!
+     * Wrapper for the available method
+     *
+     * Java prototype:
+     * `public int available() throws java.io.IOException;`
+     *
+     * JNI signature: ()I
+     *
+     */
+    int32_t available();
+
+    /*!
+     * Wrapper for the close method
+     *
+     * Java prototype:
+     * `public void close() throws java.io.IOException;`
+     *
+     * JNI signature: ()V
+     *
+     */
+    void close();
+
+    /*!
+     * Class metadata
+     */
+    struct Meta : public MetaBaseDroppable {
+        impl::MethodId<int32_t()> read;
+        impl::MethodId<int32_t(jni::Array<jni::byte_t>)> read1;
+        impl::MethodId<int32_t(jni::Array<jni::byte_t>, int32_t, int32_t)>
+            read2;
+        impl::MethodId<int64_t(int64_t)> skip;
+        impl::MethodId<int32_t()> available;
+        impl::MethodId<void()> close;
 
         /*!
          * Singleton accessor
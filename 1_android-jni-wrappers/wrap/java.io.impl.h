@@ -28,14 +28,45 @@ inline File File::construct(jni::Object &uRI) {
     return File(Meta::data().clazz().newInstance(Meta::data().init3, uRI));
 }
 
+inline std::string File::getAbsolutePath() {
+    assert(!isNull());
+    return Meta::data().getAbsolutePath.call(object());
+}
+
 inline bool File::exists() {
     assert(!isNull());
-    return object().call<bool>(Meta::data().exists);
+    return Meta::data().exists.call(object());
 }
 
 inline bool File::mkdirs() {
     assert(!isNull());
-    return object().call<bool>(Meta::data().mkdirs);
+    return Meta::data().mkdirs.call(object());
+}
+inline void OutputStream::write(int32_t intParam) {
+    assert(!isNull());
+    return Meta::data().write.call(object(), intParam);
+}
+
+inline void OutputStream::write(jni::Array<jni::byte_t> &byteParamArray) {
+    assert(!isNull());
+    return Meta::data().write1.call(object(), byteParamArray);
+}
+
+inline void OutputStream::write(jni::Array<jni::byte_t> &byteParamArray,
+                                int32_t intParam, int32_t intParam1) {
+    assert(!isNull());
+    return Meta::data().write2.call(object(), byteParamArray, intParam,
+                                    intParam1);
+}
+
+inline void OutputStream::flush() {
+    assert(!isNull());
+    return Meta::data().flush.call(object());
+}
+
+inline void OutputStream::close() {
+    assert(!isNull());
+    return Meta::data().close.call(object());
 }
 inline FileOutputStream FileOutputStream::construct(std::string &stringParam) {
     return FileOutputStream(
@@ -67,7 +98,38 @@ FileOutputStream::construct(jni::Object &fileDescriptor) {
 
 inline void FileOutputStream::close() {
     assert(!isNull());
-    return object().call<void>(Meta::data().close);
+    return Meta::data().close.call(object());
+}
+inline int32_t InputStream::read() {
+    assert(!isNull());
+    return Meta::data().read.call(object());
+}
+
+inline int32_t InputStream::read(jni::Array<jni::byte_t> &byteParamArray) {
+    assert(!isNull());
+    return Meta::data().read1.call(object(), byteParamArray);
+}
+
+inline int32_t InputStream::read(jni::Array<jni::byte_t> &byteParamArray,
+                                 int32_t intParam, int32_t intParam1) {
+    assert(!isNull());
+    return Meta::data().read2.call(object(), byteParamArray, intParam,
+                                   intParam1);
+}
+
+inline int64_t InputStream::skip(int64_t longParam) {
+    assert(!isNull());
+    return Meta::data().skip.call(object(), longParam);
+}
+
+inline int32_t InputStream::available() {
+    assert(!isNull());
+    return Meta::data().available.call(object());
+}
+
+inline void InputStream::close() {
+    assert(!isNull());
+    return Meta::data().close.call(object());
 }
 } // namespace java::io
 } // namespace wrap
@@ -8,31 +8,28 @@ namespace wrap {
 namespace java::lang {
 Class::Meta::Meta()
     : MetaBase(Class::getTypeName()),
-      forName(classRef().getStaticMethod(
-          "forName", "(Ljava/lang/String;)Ljava/lang/Class;")),
-      forName1(classRef().getStaticMethod(
-          "forName",
-          "(Ljava/lang/String;ZLjava/lang/ClassLoader;)Ljava/lang/Class;")),
-      forName2(classRef().getStaticMethod(
-          "forName",
-          "(Ljava/lang/Module;Ljava/lang/String;)Ljava/lang/Class;")),
-      getCanonicalName(
-          classRef().getMethod("getCanonicalName", "()Ljava/lang/String;")) {}
+      forName(classRef(), "forName", "(Ljava/lang/String;)Ljava/lang/Class;"),
+      forName1(classRef(), "forName",
+               "(Ljava/lang/String;ZLjava/lang/ClassLoader;)Ljava/lang/Class;"),
+      forName2(classRef(), "forName",
+               "(Ljava/lang/Module;Ljava/lang/String;)Ljava/lang/Class;"),
+      getCanonicalName(classRef(), "getCanonicalName",
+                       "()Ljava/lang/String;") {}
 ClassLoader::Meta::Meta()
     : MetaBaseDroppable(ClassLoader::getTypeName()),
-      loadClass(classRef().getMethod("loadClass",
-                                     "(Ljava/lang/String;)Ljava/lang/Class;")),
-      findLibrary(classRef().getMethod(
-          "findLibrary", "(Ljava/lang/String;)Ljava/lang/String;")) {
+      loadClass(classRef(), "loadClass",
+                "(Ljava/lang/String;)Ljava/lang/Class;"),
+      findLibrary(classRef(), "findLibrary",
+                  "(Ljava/lang/String;)Ljava/lang/String;") {
     MetaBaseDroppable::dropClassRef();
 }
 System::Meta::Meta()
     : MetaBase(System::getTypeName()),
-      mapLibraryName(classRef().getStaticMethod(
-          "mapLibraryName", "(Ljava/lang/String;)Ljava/lang/String;")) {}
+      mapLibraryName(classRef(), "mapLibraryName",
+                     "(Ljava/lang/String;)Ljava/lang/String;") {}
 Math::Meta::Meta()
     : MetaBaseDroppable(Math::getTypeName()),
-      ceil(classRef().getStaticMethod("ceil", "(D)D")) {
+      ceil(classRef(), "ceil", "(D)D") {
     MetaBaseDroppable::dropClassRef();
 }
 } // namespace java::lang
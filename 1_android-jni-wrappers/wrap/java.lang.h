@@ -79,10 +79,11 @@ class Class : public ObjectWrapperBase {
      * Class metadata
      */
     struct Meta : public MetaBase {
-        jni::method_t forName;
-        jni::method_t forName1;
-        jni::method_t forName2;
-        jni::method_t getCanonicalName;
+        impl::StaticMethodId<jni::Object(std::string)> forName;
+        impl::StaticMethodId<jni::Object(std::string, bool, jni::Object)>
+            forName1;
+        impl::StaticMethodId<jni::Object(jni::Object, std::string)> forName2;
+        impl::MethodId<std::string()> getCanonicalName;
 
         /*!
          * Singleton accessor
@@ -130,8 +131,8 @@ class ClassLoader : public ObjectWrapperBase {
      * Class metadata
      */
     struct Meta : public MetaBaseDroppable {
-        jni::method_t loadClass;
-        jni::method_t findLibrary;
+        impl::MethodId<jni::Object(std::string)> loadClass;
+        impl::MethodId<std::string(std::string)> findLibrary;
 
         /*!
          * Singleton accessor
@@ -170,7 +171,7 @@ class System : public ObjectWrapperBase {
      * Class metadata
      */
     struct Meta : public MetaBase {
-        jni::method_t mapLibraryName;
+        impl::StaticMethodId<std::string(std::string)> mapLibraryName;
 
         /*!
          * Singleton accessor
@@ -209,7 +210,7 @@ class Math : public ObjectWrapperBase {
      * Class metadata
      */
     struct Meta : public MetaBaseDroppable {
-        jni::method_t ceil;
+        impl::StaticMethodId<double(double)> ceil;
 
         /*!
          * Singleton accessor
@@ -9,42 +9,38 @@
 namespace wrap {
 namespace java::lang {
 inline Class Class::forName(std::string &stringParam) {
-    return Class(Meta::data().clazz().call<jni::Object>(Meta::data().forName,
-                                                        stringParam));
+    return Class(Meta::data().forName.call(Meta::data().clazz(), stringParam));
 }
 
 inline Class Class::forName(std::string &stringParam, bool booleanParam,
                             ClassLoader &classLoader) {
-    return Class(Meta::data().clazz().call<jni::Object>(
-        Meta::data().forName1, stringParam, booleanParam,
-        classLoader.object()));
+    return Class(Meta::data().forName1.call(
+        Meta::data().clazz(), stringParam, booleanParam, classLoader.object()));
 }
 
 inline Class Class::forName(jni::Object &module, std::string &stringParam) {
-    return Class(Meta::data().clazz().call<jni::Object>(Meta::data().forName2,
-                                                        module, stringParam));
+    return Class(Meta::data().forName2.call(Meta::data().clazz(), module,
+                                            stringParam));
 }
 
 inline std::string Class::getCanonicalName() {
     assert(!isNull());
-    return object().call<std::string>(Meta::data().getCanonicalName);
+    return Meta::data().getCanonicalName.call(object());
 }
 inline Class ClassLoader::loadClass(std::string &stringParam) {
     assert(!isNull());
-    return Class(
-        object().call<jni::Object>(Meta::data().loadClass, stringParam));
+    return Class(Meta::data().loadClass.call(object(), stringParam));
 }
 
 inline std::string ClassLoader::findLibrary(std::string &stringParam) {
     assert(!isNull());
-    return object().call<std::string>(Meta::data().findLibrary, stringParam);
+    return Meta::data().findLibrary.call(object(), stringParam);
 }
 inline std::string System::mapLibraryName(std::string &stringParam) {
-    return Meta::data().clazz().call<std::string>(Meta::data().mapLibraryName,
-                                                  stringParam);
+    return Meta::data().mapLibraryName.call(Meta::data().clazz(), stringParam);
 }
 inline double Math::ceil(double doubleParam) {
-    return Meta::data().clazz().call<double>(Meta::data().ceil, doubleParam);
+    return Meta::data().ceil.call(Meta::data().clazz(), doubleParam);
 }
 } // namespace java::lang
 } // namespace wrap
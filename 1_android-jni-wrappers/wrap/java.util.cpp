@@ -8,8 +8,11 @@ namespace wrap {
 namespace java::util {
 List::Meta::Meta()
     : MetaBaseDroppable(List::getTypeName()),
-      size(classRef().getMethod("size", "()I")),
-      get(classRef().getMethod("get", "(I)Ljava/lang/Object;")) {
+      size(classRef(), "size", "()I"),
+      toArray(classRef(), "toArray", "()[Ljava/lang/Object;"),
+      toArray1(classRef(), "toArray",
+               "([Ljava/lang/Object;)[Ljava/lang/Object;"),
+      get(classRef(), "get", "(I)Ljava/lang/Object;") {
     MetaBaseDroppable::dropClassRef();
 }
 } // namespace java::util
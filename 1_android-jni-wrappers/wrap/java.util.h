@@ -29,6 +29,28 @@ class List : public ObjectWrapperBase {
      */
     int32_t size();
 
+    /*!
+     * Wrapper for the toArray method
+     *
+     * Java prototype:
+     * `public abstract java.lang.Object[] toArray();`
+     *
+     * JNI signature: ()[Ljava/lang/Object;
+     *
+     */
+    jni::Array<jni::Object> toArray();
+
+    /*!
+     * Wrapper for the toArray method
+     *
+     * Java prototype:
+     * `public abstract <T> T[] toArray(T[]);`
+     *
+     * JNI signature: ([Ljava/lang/Object;)[Ljava/lang/Object;
+     *
+     */
+    jni::Array<jni::Object> toArray(jni::Array<jni::Object> &objectArray);
+
     /*!
      * Wrapper for the get method
      *
@@ -44,8 +66,11 @@ class List : public ObjectWrapperBase {
      * Class metadata
      */
     struct Meta : public MetaBaseDroppable {
-        jni::method_t size;
-        jni::method_t get;
+        impl::MethodId<int32_t()> size;
+        impl::MethodId<jni::Array<jni::Object>()> toArray;
+        impl::MethodId<jni::Array<jni::Object>(jni::Array<jni::Object>)>
+            toArray1;
+        impl::MethodId<jni::Object(int32_t)> get;
 
         /*!
          * Singleton accessor
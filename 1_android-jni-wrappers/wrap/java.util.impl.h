@@ -8,12 +8,23 @@ namespace wrap {
 namespace java::util {
 inline int32_t List::size() {
     assert(!isNull());
-    return object().call<int32_t>(Meta::data().size);
+    return Meta::data().size.call(object());
+}
+
+inline jni::Array<jni::Object> List::toArray() {
+    assert(!isNull());
+    return Meta::data().toArray.call(object());
+}
+
+inline jni::Array<jni::Object>
+List::toArray(jni::Array<jni::Object> &objectArray) {
+    assert(!isNull());
+    return Meta::data().toArray1.call(object(), objectArray);
 }
 
 inline jni::Object List::get(int32_t intParam) {
     assert(!isNull());
-    return object().call<jni::Object>(Meta::data().get, intParam);
+    return Meta::data().get.call(object(), intParam);
 }
 } // namespace java::util
 } // namespace wrap
@@ -15,8 +15,14 @@
 //#include <iostream>
 
 // Standard Dependencies
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <mutex>
+#include <new>
 #include <string>
+#include <type_traits>
+#include <unordered_map>
 
 // Local Dependencies
 #include "jnipp.h"
@@ -176,6 +182,143 @@ namespace jni
         return env.get();
     }
 
+    /*
+        Deferred Release Queue
+     */
+
+    struct ReleaseNode
+    {
+        jobject ref;
+        bool weak;
+        ReleaseNode* next;
+    };
+
+    /* Depth at which a thread creating a global reference drains the queue. */
+    static const std::size_t releaseBatchSize = 256;
+
+    static std::atomic<bool> deferredRelease(false);
+    static std::atomic<ReleaseNode*> releaseHead(nullptr);
+    static std::atomic<std::size_t> releaseDepth(0);
+    static std::atomic<std::size_t> releaseMaxDepth(0);
+    static std::atomic<std::size_t> releaseTotal(0);
+    static std::atomic<std::size_t> releaseDrains(0);
+    static std::atomic<long long> releaseLastNanoseconds(0);
+    static std::atomic<long long> releaseMaxNanoseconds(0);
+
+    template <class T>
+    static void storeMax(std::atomic<T>& target, T value)
+    {
+        T current = target.load(std::memory_order_relaxed);
+
+        while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+            ;
+    }
+
+    static void deleteRef(JNIEnv* env, jobject ref, bool weak)
+    {
+        if (weak)
+            env->DeleteWeakGlobalRef(ref);
+        else
+            env->DeleteGlobalRef(ref);
+    }
+
+    static void deferRef(jobject ref, bool weak) noexcept
+    {
+        ReleaseNode* node = new (std::nothrow) ReleaseNode{ ref, weak, releaseHead.load(std::memory_order_relaxed) };
+
+        // Out of memory: fall back to releasing right away.
+        if (node == nullptr)
+        {
+            deleteRef(env(), ref, weak);
+            return;
+        }
+
+        // Count before publishing, so a concurrent drain never subtracts
+        // more than has been added.
+        storeMax(releaseMaxDepth, releaseDepth.fetch_add(1, std::memory_order_relaxed) + 1);
+
+        // Multiple producers push; the consumer only ever takes the whole
+        // list at once, so a plain Treiber stack push is sufficient.
+        while (!releaseHead.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+            ;
+    }
+
+    /* Releases a global reference, deferring it if enabled. Does not call env() when deferring. */
+    static void releaseGlobalRef(jobject ref)
+    {
+        if (deferredRelease.load(std::memory_order_relaxed))
+            deferRef(ref, false);
+        else
+            env()->DeleteGlobalRef(ref);
+    }
+
+    /* Same as releaseGlobalRef(), for weak global references. */
+    static void releaseWeakGlobalRef(jobject ref)
+    {
+        if (deferredRelease.load(std::memory_order_relaxed))
+            deferRef(ref, true);
+        else
+            env()->DeleteWeakGlobalRef(ref);
+    }
+
+    static void drainIfBacklogged()
+    {
+        if (releaseDepth.load(std::memory_order_relaxed) >= releaseBatchSize)
+            drainReleaseQueue();
+    }
+
+    void setDeferredRelease(bool enabled)
+    {
+        deferredRelease.store(enabled, std::memory_order_relaxed);
+    }
+
+    std::size_t drainReleaseQueue()
+    {
+        ReleaseNode* node = releaseHead.exchange(nullptr, std::memory_order_acquire);
+
+        if (node == nullptr)
+            return 0;
+
+        auto start = std::chrono::steady_clock::now();
+        JNIEnv* env = jni::env();
+        std::size_t count = 0;
+
+        while (node != nullptr)
+        {
+            ReleaseNode* next = node->next;
+
+            deleteRef(env, node->ref, node->weak);
+            delete node;
+
+            node = next;
+            ++count;
+        }
+
+        long long elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+        releaseDepth.fetch_sub(count, std::memory_order_relaxed);
+        releaseTotal.fetch_add(count, std::memory_order_relaxed);
+        releaseDrains.fetch_add(1, std::memory_order_relaxed);
+        releaseLastNanoseconds.store(elapsed, std::memory_order_relaxed);
+        storeMax(releaseMaxNanoseconds, elapsed);
+
+        return count;
+    }
+
+    ReleaseQueueStats getReleaseQueueStats()
+    {
+        ReleaseQueueStats stats;
+
+        stats.depth                = releaseDepth.load(std::memory_order_relaxed);
+        stats.maxDepth             = releaseMaxDepth.load(std::memory_order_relaxed);
+        stats.released             = releaseTotal.load(std::memory_order_relaxed);
+        stats.drains               = releaseDrains.load(std::memory_order_relaxed);
+        stats.lastDrainNanoseconds = releaseLastNanoseconds.load(std::memory_order_relaxed);
+        stats.maxDrainNanoseconds  = releaseMaxNanoseconds.load(std::memory_order_relaxed);
+
+        return stats;
+    }
+
     static jclass findClass(const char* name)
     {
         jclass ref = env()->FindClass(name);
@@ -189,6 +332,59 @@ namespace jni
         return ref;
     }
 
+    /**
+        The well-known classes, plus the method IDs jnipp itself needs on hot
+        paths. These are resolved once and then shared by every thread.
+     */
+    struct WellKnown final
+    {
+        WellKnown();
+
+        // Instance Variables
+        Class    classes[WellKnownClassCount];
+        method_t objectToString;
+        method_t classGetName;
+        method_t systemIdentityHashCode;
+    };
+
+    WellKnown::WellKnown()
+    {
+        static const char* const names[WellKnownClassCount] = {
+            "java/lang/Object",
+            "java/lang/String",
+            "java/lang/Throwable",
+            "java/lang/Class",
+            "java/nio/ByteBuffer",
+            "java/lang/System",
+            "java/lang/Boolean",
+            "java/lang/Byte",
+            "java/lang/Character",
+            "java/lang/Short",
+            "java/lang/Integer",
+            "java/lang/Long",
+            "java/lang/Float",
+            "java/lang/Double"
+        };
+
+        for (int i = 0; i < WellKnownClassCount; ++i)
+            classes[i] = Class(names[i]);
+
+        objectToString = classes[ObjectClass].getMethod("toString", "()Ljava/lang/String;");
+        classGetName   = classes[ClassClass].getMethod("getName", "()Ljava/lang/String;");
+        systemIdentityHashCode = classes[SystemClass].getStaticMethod("identityHashCode", "(Ljava/lang/Object;)I");
+    }
+
+    static const WellKnown& wellKnown()
+    {
+        static const WellKnown instance;
+        return instance;
+    }
+
+    const Class& getWellKnownClass(WellKnownClass which)
+    {
+        return wellKnown().classes[which];
+    }
+
     static void handleJavaExceptions()
     {
         JNIEnv* env = jni::env();
@@ -200,11 +396,32 @@ namespace jni
             Object obj(exception, Object::Temporary);
 
             env->ExceptionClear();
-            std::string msg = obj.call<std::string>("toString");
+            std::string msg = obj.call<std::string>(wellKnown().objectToString);
             throw InvocationException(msg.c_str());
         }
     }
 
+    LocalFrame::LocalFrame(int capacity) : LocalFrame(jni::env(), capacity)
+    {
+    }
+
+    LocalFrame::LocalFrame(JNIEnv* env, int capacity) : _env(env)
+    {
+        if (_env->PushLocalFrame(capacity) != 0)
+            handleJavaExceptions();
+    }
+
+    LocalFrame::~LocalFrame()
+    {
+        _env->PopLocalFrame(nullptr);
+    }
+
+    /**
+        Maximum number of local references created in a single LocalFrame
+        by batched Array conversions.
+     */
+    static const jsize batchFrameCapacity = 256;
+
     static std::string toString(jobject handle, bool deleteLocal = true)
     {
         std::string result;
@@ -260,6 +477,8 @@ namespace jni
         {
             if (javaVm == nullptr && env->GetJavaVM(&javaVm) != 0)
                 throw InitializationException("Could not acquire Java VM");
+
+            wellKnown();
         }
     }
 
@@ -269,70 +488,401 @@ namespace jni
         if (isVm.compare_exchange_strong(expected, true))
         {
             javaVm = vm;
+            wellKnown();
+        }
+    }
+    /*
+        Class Canonicalization
+     */
+
+    static int identityHashCode(JNIEnv* env, jobject handle)
+    {
+        const WellKnown& known = wellKnown();
+
+        return env->CallStaticIntMethod(known.classes[SystemClass].getHandle(), known.systemIdentityHashCode, handle);
+    }
+
+    namespace internal
+    {
+        /**
+            A process-wide entry for one Java class, shared by every Object of
+            that class. Each Object that has resolved its class counts as a
+            user. An entry without users stays in the table, with its cached
+            IDs, on a bounded idle list: Objects of one class created one
+            after another keep reusing it, while classes that are no longer
+            used (and their ClassLoaders) are let go eventually.
+         */
+        struct ClassEntry
+        {
+            explicit ClassEntry(jclass clazz, int hash) : clazz(clazz), hash(hash), users(1) {}
+
+            jclass clazz;
+            int hash;
+            std::atomic<std::size_t> users; ///< Only drops to zero, or rises from it, under the table lock.
+            ClassEntry* idlePrev = nullptr; ///< Idle list links, guarded by the table lock.
+            ClassEntry* idleNext = nullptr;
+            std::mutex mutex;
+            std::unordered_map<std::string, method_t> methods;
+            std::unordered_map<std::string, field_t> fields;
+        };
+    }
+
+    /* Number of classes without users kept for reuse. */
+    static const std::size_t maxIdleClasses = 64;
+
+    static std::atomic<std::size_t> classResolutions(0);
+    static std::atomic<std::size_t> memberResolutions(0);
+
+    struct ClassTable
+    {
+        std::mutex mutex;
+        std::unordered_multimap<int, internal::ClassEntry*> entries;
+
+        // Entries without users, most recently released first. Intrusive,
+        // so that releasing the last user never allocates.
+        internal::ClassEntry* idleHead = nullptr;
+        internal::ClassEntry* idleTail = nullptr;
+        std::size_t idleCount = 0;
+
+        void pushIdle(internal::ClassEntry* entry) noexcept
+        {
+            entry->idlePrev = nullptr;
+            entry->idleNext = idleHead;
+
+            if (idleHead != nullptr)
+                idleHead->idlePrev = entry;
+            else
+                idleTail = entry;
+
+            idleHead = entry;
+            ++idleCount;
+        }
+
+        void removeIdle(internal::ClassEntry* entry) noexcept
+        {
+            if (entry->idlePrev != nullptr)
+                entry->idlePrev->idleNext = entry->idleNext;
+            else
+                idleHead = entry->idleNext;
+
+            if (entry->idleNext != nullptr)
+                entry->idleNext->idlePrev = entry->idlePrev;
+            else
+                idleTail = entry->idlePrev;
+
+            entry->idlePrev = nullptr;
+            entry->idleNext = nullptr;
+            --idleCount;
+        }
+
+        /* Takes an idle entry out of the table altogether. */
+        void evict(internal::ClassEntry* entry) noexcept
+        {
+            removeIdle(entry);
+
+            auto range = entries.equal_range(entry->hash);
+
+            for (auto i = range.first; i != range.second; ++i)
+            {
+                if (i->second == entry)
+                {
+                    entries.erase(i);
+                    break;
+                }
+            }
+        }
+    };
+
+    static ClassTable& classTable()
+    {
+        // Never destroyed: static Objects may release their classes at exit.
+        static ClassTable* instance = new ClassTable;
+        return *instance;
+    }
+
+    static internal::ClassEntry* canonicalClass(JNIEnv* env, jclass classRef)
+    {
+        // Identity hash codes narrow the search; IsSameObject settles it.
+        int hash = identityHashCode(env, classRef);
+        ClassTable& table = classTable();
+        std::lock_guard<std::mutex> lock(table.mutex);
+
+        auto range = table.entries.equal_range(hash);
+
+        for (auto i = range.first; i != range.second; ++i)
+        {
+            if (env->IsSameObject(i->second->clazz, classRef))
+            {
+                if (i->second->users.fetch_add(1, std::memory_order_relaxed) == 0)
+                    table.removeIdle(i->second);
+
+                return i->second;
+            }
+        }
+
+        internal::ClassEntry* entry = new internal::ClassEntry(jclass(env->NewGlobalRef(classRef)), hash);
+        table.entries.emplace(hash, entry);
+        classResolutions.fetch_add(1, std::memory_order_relaxed);
+        return entry;
+    }
+
+    static void deleteClassEntry(internal::ClassEntry* entry) noexcept
+    {
+        releaseGlobalRef(entry->clazz);
+        delete entry;
+    }
+
+    static void retainClass(internal::ClassEntry* entry) noexcept
+    {
+        if (entry != nullptr)
+            entry->users.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void releaseClass(internal::ClassEntry* entry) noexcept
+    {
+        if (entry == nullptr)
+            return;
+
+        // Fast path: this cannot be the last user, so no lookup can race us.
+        std::size_t users = entry->users.load(std::memory_order_relaxed);
+
+        while (users > 1)
+        {
+            if (entry->users.compare_exchange_weak(users, users - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+                return;
+        }
+
+        // Possibly the last user: decide under the table lock, which
+        // canonicalClass() also holds while it hands out new uses.
+        ClassTable& table = classTable();
+        internal::ClassEntry* evicted = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(table.mutex);
+
+            if (entry->users.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                return;
+
+            // Keep it for the next Object of this class; drop the one
+            // idle the longest if there are too many.
+            table.pushIdle(entry);
+
+            if (table.idleCount > maxIdleClasses)
+            {
+                evicted = table.idleTail;
+                table.evict(evicted);
+            }
+        }
+
+        if (evicted != nullptr)
+            deleteClassEntry(evicted);
+    }
+
+    std::size_t purgeClassTable()
+    {
+        ClassTable& table = classTable();
+        internal::ClassEntry* purged = nullptr;
+        std::size_t count = 0;
+        {
+            std::lock_guard<std::mutex> lock(table.mutex);
+
+            while (table.idleHead != nullptr)
+            {
+                internal::ClassEntry* entry = table.idleHead;
+
+                table.evict(entry);
+                entry->idleNext = purged;
+                purged = entry;
+                ++count;
+            }
+        }
+
+        while (purged != nullptr)
+        {
+            internal::ClassEntry* next = purged->idleNext;
+
+            deleteClassEntry(purged);
+            purged = next;
+        }
+
+        return count;
+    }
+
+    ClassTableStats getClassTableStats()
+    {
+        ClassTable& table = classTable();
+        ClassTableStats stats;
+        {
+            std::lock_guard<std::mutex> lock(table.mutex);
+
+            stats.classes     = table.entries.size();
+            stats.idleClasses = table.idleCount;
+        }
+
+        stats.classResolutions  = classResolutions.load(std::memory_order_relaxed);
+        stats.memberResolutions = memberResolutions.load(std::memory_order_relaxed);
+
+        return stats;
+    }
+
+    static method_t cachedMethod(internal::ClassEntry* entry, const char* name, const char* signature)
+    {
+        std::string key = std::string(name) + signature;
+
+        {
+            std::lock_guard<std::mutex> lock(entry->mutex);
+            auto i = entry->methods.find(key);
+
+            if (i != entry->methods.end())
+                return i->second;
+        }
+
+        method_t id = Class(entry->clazz, Object::Temporary).getMethod(name, signature);
+        memberResolutions.fetch_add(1, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(entry->mutex);
+        entry->methods.emplace(key, id);
+        return id;
+    }
+
+    static field_t cachedField(internal::ClassEntry* entry, const char* name, const char* signature)
+    {
+        std::string key = std::string(name) + ':' + signature;
+
+        {
+            std::lock_guard<std::mutex> lock(entry->mutex);
+            auto i = entry->fields.find(key);
+
+            if (i != entry->fields.end())
+                return i->second;
         }
+
+        field_t id = Class(entry->clazz, Object::Temporary).getField(name, signature);
+        memberResolutions.fetch_add(1, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(entry->mutex);
+        entry->fields.emplace(key, id);
+        return id;
     }
+
     /*
         Object Implementation
      */
 
-    Object::Object() noexcept : _handle(nullptr), _class(nullptr), _isGlobal(false)
+    namespace internal
     {
+        struct SharedRef
+        {
+            explicit SharedRef(jobject handle) : handle(handle), count(1) {}
+
+            jobject handle;
+            std::atomic<int> count;
+        };
     }
 
-    Object::Object(const Object& other) : _handle(nullptr), _class(nullptr), _isGlobal(!other.isNull())
+    static void retainShared(internal::SharedRef* shared) noexcept
     {
-        if (!other.isNull())
-            _handle = env()->NewGlobalRef(other._handle);
+        shared->count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void releaseShared(internal::SharedRef* shared)
+    {
+        if (shared->count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            releaseGlobalRef(shared->handle);
+            delete shared;
+        }
+    }
+
+    Object::Object() noexcept : _handle(nullptr), _class(nullptr), _isGlobal(false), _shared(nullptr)
+    {
+    }
+
+    Object::Object(const Object& other) : _handle(nullptr), _class(other._class), _isGlobal(false), _shared(other._shared)
+    {
+        retainClass(_class);
+
+        if (_shared != nullptr)
+        {
+            retainShared(_shared);
+            _handle = other._handle;
+        }
+        else if (!other.isNull())
+        {
+            _handle   = env()->NewGlobalRef(other._handle);
+            _isGlobal = true;
+        }
     }
 
-    Object::Object(Object&& other) noexcept : _handle(other._handle), _class(other._class), _isGlobal(other._isGlobal)
+    Object::Object(Object&& other) noexcept : _handle(other._handle), _class(other._class), _isGlobal(other._isGlobal), _shared(other._shared)
     {
         other._handle   = nullptr;
         other._class    = nullptr;
         other._isGlobal = false;
+        other._shared   = nullptr;
     }
 
-    Object::Object(jobject ref, int scopeFlags) : _handle(ref), _class(nullptr), _isGlobal((scopeFlags & Temporary) == 0)
+    Object::Object(jobject ref, int scopeFlags) : _handle(ref), _class(nullptr), _isGlobal((scopeFlags & Temporary) == 0), _shared(nullptr)
     {
         if (!_isGlobal)
             return;
 
         JNIEnv* env = jni::env();
 
+        drainIfBacklogged();
+
         _handle = env->NewGlobalRef(ref);
 
+        if ((scopeFlags & Shared) && _handle != nullptr)
+        {
+            // The control block owns the global reference, not this Object.
+            _shared   = new internal::SharedRef(_handle);
+            _isGlobal = false;
+        }
+
         if (scopeFlags & DeleteLocalInput)
             env->DeleteLocalRef(ref);
     }
 
     Object::~Object() noexcept
     {
-        JNIEnv* env = jni::env();
-
         if (_isGlobal)
-            env->DeleteGlobalRef(_handle);
+            releaseGlobalRef(_handle);
+
+        if (_shared != nullptr)
+            releaseShared(_shared);
 
-        if (_class != nullptr)
-            env->DeleteGlobalRef(_class);
+        releaseClass(_class);
     }
 
     Object& Object::operator=(const Object& other)
     {
         if (_handle != other._handle)
         {
-            JNIEnv* env = jni::env();
-
             // Ditch the old reference.
             if (_isGlobal)
-                env->DeleteGlobalRef(_handle);
-            if (_class != nullptr)
-                env->DeleteGlobalRef(_class);
+                releaseGlobalRef(_handle);
+            if (_shared != nullptr)
+                releaseShared(_shared);
 
             // Assign the new reference.
-            if ((_isGlobal = !other.isNull()) != false)
-                _handle = env->NewGlobalRef(other._handle);
+            _handle   = nullptr;
+            _isGlobal = false;
+            _shared   = other._shared;
 
-            _class = nullptr;
+            if (_shared != nullptr)
+            {
+                retainShared(_shared);
+                _handle = other._handle;
+            }
+            else if (!other.isNull())
+            {
+                _handle   = env()->NewGlobalRef(other._handle);
+                _isGlobal = true;
+            }
+
+            retainClass(other._class);
+            releaseClass(_class);
+            _class = other._class;
         }
 
         return *this;
@@ -347,30 +897,51 @@ namespace jni
     {
         if (_handle != other._handle)
         {
-            JNIEnv* env = jni::env();
-
             // Ditch the old reference.
             if (_isGlobal)
-                env->DeleteGlobalRef(_handle);
-            if (_class != nullptr)
-                env->DeleteGlobalRef(_class);
+                releaseGlobalRef(_handle);
+            if (_shared != nullptr)
+                releaseShared(_shared);
+
+            releaseClass(_class);
 
             // Assign the new reference.
             _handle   = other._handle;
             _isGlobal = other._isGlobal;
+            _shared   = other._shared;
             _class    = other._class;
 
             other._handle   = nullptr;
             other._isGlobal = false;
+            other._shared   = nullptr;
             other._class    = nullptr;
         }
 
         return *this;
     }
 
+    Object Object::makeShared() const
+    {
+        if (_shared != nullptr)
+            return *this;
+
+        if (isNull())
+            return Object();
+
+        return Object(_handle, Shared);
+    }
+
     bool Object::isNull() const noexcept
     {
-        return _handle == nullptr || env()->IsSameObject(_handle, nullptr);
+        if (_handle == nullptr)
+            return true;
+
+        // Owned and shared references are strong global references, which
+        // cannot be cleared behind our back.
+        if (_isGlobal || _shared != nullptr)
+            return false;
+
+        return env()->IsSameObject(_handle, nullptr) != JNI_FALSE;
     }
 
     void Object::callMethod(method_t method, internal::value_t* args, internal::ReturnTypeWrapper<void> const&) const
@@ -630,34 +1201,44 @@ namespace jni
         env()->SetObjectField(_handle, field, value ? value->getHandle() : nullptr);
     }
 
-    jclass Object::getClass() const
+    internal::ClassEntry* Object::getClassEntry() const
     {
         if (_class == nullptr)
         {
             JNIEnv* env = jni::env();
 
             jclass classRef = env->GetObjectClass(_handle);
-            _class = jclass(env->NewGlobalRef(classRef));
+            _class = canonicalClass(env, classRef);
             env->DeleteLocalRef(classRef);
         }
 
         return _class;
     }
 
-    method_t Object::getMethod(const char* name, const char* signature) const
+    jclass Object::getClass() const
     {
-        return Class(getClass(), Temporary).getMethod(name, signature);
+        return getClassEntry()->clazz;
     }
 
-    method_t Object::getMethod(const char* nameAndSignature) const
+    method_t Object::getMethod(const char* name, const char* signature) const
     {
-        return Class(getClass(), Temporary).getMethod(nameAndSignature);
+        return cachedMethod(getClassEntry(), name, signature);
     }
 
-    field_t Object::getField(const char* name, const char* signature) const
+    method_t Object::getMethod(const char* nameAndSignature) const
     {
-        return Class(getClass(), Temporary).getField(name, signature);
-    }
+        const char* sig = std::strchr(nameAndSignature, '(');
+
+        if (sig == nullptr)
+            throw NameResolutionException(nameAndSignature);
+
+        return getMethod(std::string(nameAndSignature, sig - nameAndSignature).c_str(), sig);
+    }
+
+    field_t Object::getField(const char* name, const char* signature) const
+    {
+        return cachedField(getClassEntry(), name, signature);
+    }
 
     jobject Object::makeLocalReference() const 
     {
@@ -666,6 +1247,175 @@ namespace jni
         return env()->NewLocalRef(_handle);
     }
 
+    /*
+        Ref Implementation
+     */
+
+    Ref::Ref(const Ref& other) : _handle(nullptr)
+    {
+        if (other._handle != nullptr)
+            _handle = env()->NewGlobalRef(other._handle);
+    }
+
+    Ref::Ref(const Object& object) : _handle(nullptr)
+    {
+        if (!object.isNull())
+            _handle = env()->NewGlobalRef(object.getHandle());
+    }
+
+    Ref::Ref(Object&& object) : _handle(nullptr)
+    {
+        if (object._isGlobal)
+        {
+            // Steal the global reference rather than creating another one.
+            _handle = object._handle;
+            object._handle   = nullptr;
+            object._isGlobal = false;
+        }
+        else if (!object.isNull())
+        {
+            _handle = env()->NewGlobalRef(object._handle);
+        }
+    }
+
+    Ref::~Ref() noexcept
+    {
+        if (_handle != nullptr)
+            releaseGlobalRef(_handle);
+    }
+
+    Ref& Ref::operator=(const Ref& other)
+    {
+        if (_handle != other._handle)
+        {
+            if (_handle != nullptr)
+                releaseGlobalRef(_handle);
+
+            _handle = other._handle != nullptr ? env()->NewGlobalRef(other._handle) : nullptr;
+        }
+
+        return *this;
+    }
+
+    Ref& Ref::operator=(Ref&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (_handle != nullptr)
+                releaseGlobalRef(_handle);
+
+            _handle = other._handle;
+            other._handle = nullptr;
+        }
+
+        return *this;
+    }
+
+    bool Ref::operator==(const Ref& other) const
+    {
+        return env()->IsSameObject(_handle, other._handle) != JNI_FALSE;
+    }
+
+    Object Ref::toObject() const
+    {
+        return Object(_handle);
+    }
+
+    /*
+        WeakObject Implementation
+     */
+
+    WeakObject::WeakObject(const Object& object) : _handle(nullptr), _hash(0)
+    {
+        if (!object.isNull())
+        {
+            JNIEnv* env = jni::env();
+
+            _handle = env->NewWeakGlobalRef(object.getHandle());
+            _hash   = identityHashCode(env, object.getHandle());
+        }
+    }
+
+    WeakObject::WeakObject(const WeakObject& other) : _handle(nullptr), _hash(other._hash)
+    {
+        if (other._handle != nullptr)
+            _handle = env()->NewWeakGlobalRef(other._handle);
+    }
+
+    WeakObject::~WeakObject() noexcept
+    {
+        if (_handle != nullptr)
+            releaseWeakGlobalRef(_handle);
+    }
+
+    WeakObject& WeakObject::operator=(const WeakObject& other)
+    {
+        if (this != &other)
+        {
+            JNIEnv* env = jni::env();
+
+            if (_handle != nullptr)
+                releaseWeakGlobalRef(_handle);
+
+            _handle = other._handle != nullptr ? env->NewWeakGlobalRef(other._handle) : nullptr;
+            _hash   = other._hash;
+        }
+
+        return *this;
+    }
+
+    WeakObject& WeakObject::operator=(WeakObject&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (_handle != nullptr)
+                releaseWeakGlobalRef(_handle);
+
+            _handle = other._handle;
+            _hash   = other._hash;
+            other._handle = nullptr;
+        }
+
+        return *this;
+    }
+
+    bool WeakObject::operator==(const WeakObject& other) const
+    {
+        // Different hash codes mean different objects, without asking the VM.
+        if (_hash != other._hash)
+            return false;
+
+        return env()->IsSameObject(_handle, other._handle) != JNI_FALSE;
+    }
+
+    bool WeakObject::operator==(const Object& other) const
+    {
+        return env()->IsSameObject(_handle, other.getHandle()) != JNI_FALSE;
+    }
+
+    bool WeakObject::expired() const noexcept
+    {
+        return _handle == nullptr || env()->IsSameObject(_handle, nullptr) != JNI_FALSE;
+    }
+
+    Object WeakObject::lock(int scopeFlags) const
+    {
+        if (_handle == nullptr)
+            return Object();
+
+        // Promoting to a local reference is what keeps the referent alive;
+        // the result is null if it has already been collected.
+        jobject local = env()->NewLocalRef(_handle);
+
+        if (local == nullptr)
+            return Object();
+
+        if (scopeFlags & Object::Temporary)
+            return Object(local, Object::Temporary);
+
+        return Object(local, Object::DeleteLocalInput);
+    }
+
     /*
         Class Implementation
      */
@@ -764,7 +1514,7 @@ namespace jni
 
     std::string Class::getName() const
     {
-        return Object::call<std::string>("getName");
+        return Object::call<std::string>(wellKnown().classGetName);
     }
 
     template <> bool Class::get(field_t field) const
@@ -1148,15 +1898,15 @@ namespace jni
     {
     }
 
-    template <> Array<std::string>::Array(long length) : Object(env()->NewObjectArray(length, Class("java/lang/String").getHandle(), nullptr)), _length(length)
+    template <> Array<std::string>::Array(long length) : Object(env()->NewObjectArray(length, getWellKnownClass(StringClass).getHandle(), nullptr), DeleteLocalInput), _length(length)
     {
     }
 
-    template <> Array<std::wstring>::Array(long length) : Object(env()->NewObjectArray(length, Class("java/lang/String").getHandle(), nullptr)), _length(length)
+    template <> Array<std::wstring>::Array(long length) : Object(env()->NewObjectArray(length, getWellKnownClass(StringClass).getHandle(), nullptr), DeleteLocalInput), _length(length)
     {
     }
 
-    template <> Array<Object>::Array(long length) : Object(env()->NewObjectArray(length, Class("java/lang/Object").getHandle(), nullptr)), _length(length)
+    template <> Array<Object>::Array(long length) : Object(env()->NewObjectArray(length, getWellKnownClass(ObjectClass).getHandle(), nullptr), DeleteLocalInput), _length(length)
     {
     }
 
@@ -1351,6 +2101,596 @@ namespace jni
         handleJavaExceptions();
     }
 
+    /*
+        Batched Array Conversions
+     */
+
+    /**
+        Whether a std::vector of TElement can be handed straight to the JNI
+        array region functions expecting TJni, with no staging buffer.
+     */
+    template <class TElement, class TJni>
+    using IsSameRepresentation = std::integral_constant<bool,
+        sizeof(TElement) == sizeof(TJni) && !std::is_same<TElement, bool>::value>;
+
+    template <class TElement, class TJni, class TArray>
+    static void getRegion(JNIEnv* env, TArray array, void (JNIEnv::*fn)(TArray, jsize, jsize, TJni*), std::vector<TElement>& output, std::true_type)
+    {
+        (env->*fn)(array, 0, jsize(output.size()), reinterpret_cast<TJni*>(output.data()));
+    }
+
+    template <class TElement, class TJni, class TArray>
+    static void getRegion(JNIEnv* env, TArray array, void (JNIEnv::*fn)(TArray, jsize, jsize, TJni*), std::vector<TElement>& output, std::false_type)
+    {
+        std::vector<TJni> buffer(output.size());
+        (env->*fn)(array, 0, jsize(buffer.size()), buffer.data());
+        std::copy(buffer.begin(), buffer.end(), output.begin());
+    }
+
+    template <class TElement, class TJni, class TArray>
+    static void setRegion(JNIEnv* env, TArray array, void (JNIEnv::*fn)(TArray, jsize, jsize, const TJni*), const std::vector<TElement>& input, std::true_type)
+    {
+        (env->*fn)(array, 0, jsize(input.size()), reinterpret_cast<const TJni*>(input.data()));
+    }
+
+    template <class TElement, class TJni, class TArray>
+    static void setRegion(JNIEnv* env, TArray array, void (JNIEnv::*fn)(TArray, jsize, jsize, const TJni*), const std::vector<TElement>& input, std::false_type)
+    {
+        std::vector<TJni> buffer(input.begin(), input.end());
+        (env->*fn)(array, 0, jsize(buffer.size()), buffer.data());
+    }
+
+    template <class TElement, class TJni, class TArray>
+    static void getRegion(JNIEnv* env, TArray array, void (JNIEnv::*fn)(TArray, jsize, jsize, TJni*), jsize start, jsize length, TElement* output, std::true_type)
+    {
+        (env->*fn)(array, start, length, reinterpret_cast<TJni*>(output));
+    }
+
+    template <class TElement, class TJni, class TArray>
+    static void getRegion(JNIEnv* env, TArray array, void (JNIEnv::*fn)(TArray, jsize, jsize, TJni*), jsize start, jsize length, TElement* output, std::false_type)
+    {
+        std::vector<TJni> buffer(length);
+        (env->*fn)(array, start, length, buffer.data());
+        std::copy(buffer.begin(), buffer.end(), output);
+    }
+
+    template <class TElement, class TJni, class TArray>
+    static void setRegion(JNIEnv* env, TArray array, void (JNIEnv::*fn)(TArray, jsize, jsize, const TJni*), jsize start, jsize length, const TElement* input, std::true_type)
+    {
+        (env->*fn)(array, start, length, reinterpret_cast<const TJni*>(input));
+    }
+
+    template <class TElement, class TJni, class TArray>
+    static void setRegion(JNIEnv* env, TArray array, void (JNIEnv::*fn)(TArray, jsize, jsize, const TJni*), jsize start, jsize length, const TElement* input, std::false_type)
+    {
+        std::vector<TJni> buffer(input, input + length);
+        (env->*fn)(array, start, length, buffer.data());
+    }
+
+    template <class TElement, class TJni, class TArray>
+    static void copyFromArray(const Array<TElement>& array, long start, long length, TElement* output, void (JNIEnv::*fn)(TArray, jsize, jsize, TJni*))
+    {
+        if (length > 0)
+        {
+            getRegion(env(), TArray(array.getHandle()), fn, jsize(start), jsize(length), output, IsSameRepresentation<TElement, TJni>());
+            handleJavaExceptions();
+        }
+    }
+
+    template <class TElement, class TJni, class TArray>
+    static void copyIntoArray(const Array<TElement>& array, long start, long length, const TElement* input, void (JNIEnv::*fn)(TArray, jsize, jsize, const TJni*))
+    {
+        if (length > 0)
+        {
+            setRegion(env(), TArray(array.getHandle()), fn, jsize(start), jsize(length), input, IsSameRepresentation<TElement, TJni>());
+            handleJavaExceptions();
+        }
+    }
+
+    template <class TElement, class TJni, class TArray>
+    static std::vector<TElement> copyToVector(const Array<TElement>& array, void (JNIEnv::*fn)(TArray, jsize, jsize, TJni*))
+    {
+        std::vector<TElement> result(array.getLength());
+
+        if (!result.empty())
+        {
+            getRegion(env(), TArray(array.getHandle()), fn, result, IsSameRepresentation<TElement, TJni>());
+            handleJavaExceptions();
+        }
+
+        return result;
+    }
+
+    template <class TElement, class TJni, class TArray>
+    static jobject newPrimitiveArray(const std::vector<TElement>& values, TArray (JNIEnv::*create)(jsize), void (JNIEnv::*fn)(TArray, jsize, jsize, const TJni*))
+    {
+        JNIEnv* env = jni::env();
+
+        TArray array = (env->*create)(jsize(values.size()));
+        handleJavaExceptions();
+
+        if (!values.empty())
+        {
+            setRegion(env, array, fn, values, IsSameRepresentation<TElement, TJni>());
+            handleJavaExceptions();
+        }
+
+        return array;
+    }
+
+    template <class TElement, class TConvert>
+    static jobject newStringArray(const std::vector<TElement>& values, TConvert convert)
+    {
+        JNIEnv* env = jni::env();
+        jsize length = jsize(values.size());
+
+        jobjectArray array = env->NewObjectArray(length, getWellKnownClass(StringClass).getHandle(), nullptr);
+        handleJavaExceptions();
+
+        for (jsize start = 0; start < length && !env->ExceptionCheck(); start += batchFrameCapacity)
+        {
+            jsize end = std::min(length, start + batchFrameCapacity);
+            LocalFrame frame(env, end - start);
+
+            for (jsize i = start; i < end; ++i)
+            {
+                jobject element = convert(env, values[i]);
+
+                // A null result means an OutOfMemoryError is pending.
+                if (element == nullptr)
+                    break;
+
+                env->SetObjectArrayElement(array, i, element);
+            }
+        }
+
+        if (env->ExceptionCheck())
+        {
+            env->DeleteLocalRef(array);
+            handleJavaExceptions();
+        }
+
+        return array;
+    }
+
+    template <> Array<bool>::Array(const std::vector<bool>& values) : Object(newPrimitiveArray(values, &JNIEnv::NewBooleanArray, &JNIEnv::SetBooleanArrayRegion), DeleteLocalInput), _length(long(values.size()))
+    {
+    }
+
+    template <> Array<byte_t>::Array(const std::vector<byte_t>& values) : Object(newPrimitiveArray(values, &JNIEnv::NewByteArray, &JNIEnv::SetByteArrayRegion), DeleteLocalInput), _length(long(values.size()))
+    {
+    }
+
+    template <> Array<wchar_t>::Array(const std::vector<wchar_t>& values) : Object(newPrimitiveArray(values, &JNIEnv::NewCharArray, &JNIEnv::SetCharArrayRegion), DeleteLocalInput), _length(long(values.size()))
+    {
+    }
+
+    template <> Array<short>::Array(const std::vector<short>& values) : Object(newPrimitiveArray(values, &JNIEnv::NewShortArray, &JNIEnv::SetShortArrayRegion), DeleteLocalInput), _length(long(values.size()))
+    {
+    }
+
+    template <> Array<int>::Array(const std::vector<int>& values) : Object(newPrimitiveArray(values, &JNIEnv::NewIntArray, &JNIEnv::SetIntArrayRegion), DeleteLocalInput), _length(long(values.size()))
+    {
+    }
+
+    template <> Array<long long>::Array(const std::vector<long long>& values) : Object(newPrimitiveArray(values, &JNIEnv::NewLongArray, &JNIEnv::SetLongArrayRegion), DeleteLocalInput), _length(long(values.size()))
+    {
+    }
+
+    template <> Array<long>::Array(const std::vector<long>& values) : Object(newPrimitiveArray(values, &JNIEnv::NewLongArray, &JNIEnv::SetLongArrayRegion), DeleteLocalInput), _length(long(values.size()))
+    {
+    }
+
+    template <> Array<float>::Array(const std::vector<float>& values) : Object(newPrimitiveArray(values, &JNIEnv::NewFloatArray, &JNIEnv::SetFloatArrayRegion), DeleteLocalInput), _length(long(values.size()))
+    {
+    }
+
+    template <> Array<double>::Array(const std::vector<double>& values) : Object(newPrimitiveArray(values, &JNIEnv::NewDoubleArray, &JNIEnv::SetDoubleArrayRegion), DeleteLocalInput), _length(long(values.size()))
+    {
+    }
+
+    template <> Array<std::string>::Array(const std::vector<std::string>& values) : Object(newStringArray(values, [](JNIEnv* env, const std::string& value) -> jobject {
+            return env->NewStringUTF(value.c_str());
+        }), DeleteLocalInput), _length(long(values.size()))
+    {
+    }
+
+    template <> Array<std::wstring>::Array(const std::vector<std::wstring>& values) : Object(newStringArray(values, [](JNIEnv* env, const std::wstring& value) -> jobject {
+#ifdef _WIN32
+            return env->NewString((const jchar*) value.c_str(), jsize(value.length()));
+#else
+            auto jstr = toJString(value.c_str(), value.length());
+            return env->NewString(jstr.c_str(), jsize(jstr.length()));
+#endif
+        }), DeleteLocalInput), _length(long(values.size()))
+    {
+    }
+
+    static jobject newObjectArray(const std::vector<Object>& values)
+    {
+        JNIEnv* env = jni::env();
+        jsize length = jsize(values.size());
+
+        jobjectArray array = env->NewObjectArray(length, getWellKnownClass(ObjectClass).getHandle(), nullptr);
+        handleJavaExceptions();
+
+        for (jsize i = 0; i < length; ++i)
+            env->SetObjectArrayElement(array, i, values[i].getHandle());
+
+        return array;
+    }
+
+    template <> Array<Object>::Array(const std::vector<Object>& values) : Object(newObjectArray(values), DeleteLocalInput), _length(long(values.size()))
+    {
+    }
+
+    template <> std::vector<bool> Array<bool>::toVector() const
+    {
+        return copyToVector(*this, &JNIEnv::GetBooleanArrayRegion);
+    }
+
+    template <> std::vector<byte_t> Array<byte_t>::toVector() const
+    {
+        return copyToVector(*this, &JNIEnv::GetByteArrayRegion);
+    }
+
+    template <> std::vector<wchar_t> Array<wchar_t>::toVector() const
+    {
+        return copyToVector(*this, &JNIEnv::GetCharArrayRegion);
+    }
+
+    template <> std::vector<short> Array<short>::toVector() const
+    {
+        return copyToVector(*this, &JNIEnv::GetShortArrayRegion);
+    }
+
+    template <> std::vector<int> Array<int>::toVector() const
+    {
+        return copyToVector(*this, &JNIEnv::GetIntArrayRegion);
+    }
+
+    template <> std::vector<long long> Array<long long>::toVector() const
+    {
+        return copyToVector(*this, &JNIEnv::GetLongArrayRegion);
+    }
+
+    template <> std::vector<long> Array<long>::toVector() const
+    {
+        return copyToVector(*this, &JNIEnv::GetLongArrayRegion);
+    }
+
+    template <> std::vector<float> Array<float>::toVector() const
+    {
+        return copyToVector(*this, &JNIEnv::GetFloatArrayRegion);
+    }
+
+    template <> std::vector<double> Array<double>::toVector() const
+    {
+        return copyToVector(*this, &JNIEnv::GetDoubleArrayRegion);
+    }
+
+    template <> void Array<bool>::getRegion(long start, long length, bool* values) const
+    {
+        copyFromArray(*this, start, length, values, &JNIEnv::GetBooleanArrayRegion);
+    }
+
+    template <> void Array<bool>::setRegion(long start, long length, const bool* values)
+    {
+        copyIntoArray(*this, start, length, values, &JNIEnv::SetBooleanArrayRegion);
+    }
+
+    template <> void Array<byte_t>::getRegion(long start, long length, byte_t* values) const
+    {
+        copyFromArray(*this, start, length, values, &JNIEnv::GetByteArrayRegion);
+    }
+
+    template <> void Array<byte_t>::setRegion(long start, long length, const byte_t* values)
+    {
+        copyIntoArray(*this, start, length, values, &JNIEnv::SetByteArrayRegion);
+    }
+
+    template <> void Array<wchar_t>::getRegion(long start, long length, wchar_t* values) const
+    {
+        copyFromArray(*this, start, length, values, &JNIEnv::GetCharArrayRegion);
+    }
+
+    template <> void Array<wchar_t>::setRegion(long start, long length, const wchar_t* values)
+    {
+        copyIntoArray(*this, start, length, values, &JNIEnv::SetCharArrayRegion);
+    }
+
+    template <> void Array<short>::getRegion(long start, long length, short* values) const
+    {
+        copyFromArray(*this, start, length, values, &JNIEnv::GetShortArrayRegion);
+    }
+
+    template <> void Array<short>::setRegion(long start, long length, const short* values)
+    {
+        copyIntoArray(*this, start, length, values, &JNIEnv::SetShortArrayRegion);
+    }
+
+    template <> void Array<int>::getRegion(long start, long length, int* values) const
+    {
+        copyFromArray(*this, start, length, values, &JNIEnv::GetIntArrayRegion);
+    }
+
+    template <> void Array<int>::setRegion(long start, long length, const int* values)
+    {
+        copyIntoArray(*this, start, length, values, &JNIEnv::SetIntArrayRegion);
+    }
+
+    template <> void Array<long long>::getRegion(long start, long length, long long* values) const
+    {
+        copyFromArray(*this, start, length, values, &JNIEnv::GetLongArrayRegion);
+    }
+
+    template <> void Array<long long>::setRegion(long start, long length, const long long* values)
+    {
+        copyIntoArray(*this, start, length, values, &JNIEnv::SetLongArrayRegion);
+    }
+
+    template <> void Array<long>::getRegion(long start, long length, long* values) const
+    {
+        copyFromArray(*this, start, length, values, &JNIEnv::GetLongArrayRegion);
+    }
+
+    template <> void Array<long>::setRegion(long start, long length, const long* values)
+    {
+        copyIntoArray(*this, start, length, values, &JNIEnv::SetLongArrayRegion);
+    }
+
+    template <> void Array<float>::getRegion(long start, long length, float* values) const
+    {
+        copyFromArray(*this, start, length, values, &JNIEnv::GetFloatArrayRegion);
+    }
+
+    template <> void Array<float>::setRegion(long start, long length, const float* values)
+    {
+        copyIntoArray(*this, start, length, values, &JNIEnv::SetFloatArrayRegion);
+    }
+
+    template <> void Array<double>::getRegion(long start, long length, double* values) const
+    {
+        copyFromArray(*this, start, length, values, &JNIEnv::GetDoubleArrayRegion);
+    }
+
+    template <> void Array<double>::setRegion(long start, long length, const double* values)
+    {
+        copyIntoArray(*this, start, length, values, &JNIEnv::SetDoubleArrayRegion);
+    }
+
+    template <> std::vector<std::string> Array<std::string>::toVector() const
+    {
+        JNIEnv* env = jni::env();
+        jobjectArray array = jobjectArray(getHandle());
+        jsize length = jsize(getLength());
+
+        std::vector<std::string> result(length);
+
+        for (jsize start = 0; start < length; start += batchFrameCapacity)
+        {
+            jsize end = std::min(length, start + batchFrameCapacity);
+            LocalFrame frame(env, end - start);
+
+            for (jsize i = start; i < end; ++i)
+            {
+                jstring element = jstring(env->GetObjectArrayElement(array, i));
+
+                if (element == nullptr)
+                    continue;
+
+                // Decode straight into the output, leaving room for the
+                // terminator GetStringUTFRegion writes after the last byte.
+                std::string& output = result[i];
+                jsize bytes = env->GetStringUTFLength(element);
+                output.resize(bytes + 1);
+                env->GetStringUTFRegion(element, 0, env->GetStringLength(element), &output[0]);
+                output.resize(bytes);
+            }
+        }
+
+        handleJavaExceptions();
+        return result;
+    }
+
+    template <> std::vector<std::wstring> Array<std::wstring>::toVector() const
+    {
+        JNIEnv* env = jni::env();
+        jobjectArray array = jobjectArray(getHandle());
+        jsize length = jsize(getLength());
+
+        std::vector<std::wstring> result(length);
+#ifndef _WIN32
+        std::basic_string<jchar> buffer;
+#endif
+
+        for (jsize start = 0; start < length; start += batchFrameCapacity)
+        {
+            jsize end = std::min(length, start + batchFrameCapacity);
+            LocalFrame frame(env, end - start);
+
+            for (jsize i = start; i < end; ++i)
+            {
+                jstring element = jstring(env->GetObjectArrayElement(array, i));
+
+                if (element == nullptr)
+                    continue;
+
+                jsize chars = env->GetStringLength(element);
+#ifdef _WIN32
+                result[i].resize(chars);
+                env->GetStringRegion(element, 0, chars, (jchar*) &result[i][0]);
+#else
+                buffer.resize(chars);
+                env->GetStringRegion(element, 0, chars, &buffer[0]);
+                result[i] = toWString(buffer.data(), chars);
+#endif
+            }
+        }
+
+        handleJavaExceptions();
+        return result;
+    }
+
+    template <> std::vector<Object> Array<Object>::toVector() const
+    {
+        JNIEnv* env = jni::env();
+        jobjectArray array = jobjectArray(getHandle());
+        jsize length = jsize(getLength());
+
+        std::vector<Object> result;
+        result.reserve(length);
+
+        for (jsize start = 0; start < length; start += batchFrameCapacity)
+        {
+            jsize end = std::min(length, start + batchFrameCapacity);
+            LocalFrame frame(env, end - start);
+
+            for (jsize i = start; i < end; ++i)
+                result.push_back(Object(env->GetObjectArrayElement(array, i)));
+        }
+
+        handleJavaExceptions();
+        return result;
+    }
+
+    /*
+        Field Snapshots
+     */
+
+    namespace internal
+    {
+        void readField(JNIEnv* env, jobject obj, field_t field, bool& value)      { value = env->GetBooleanField(obj, field) != 0; }
+        void readField(JNIEnv* env, jobject obj, field_t field, byte_t& value)    { value = env->GetByteField(obj, field); }
+        void readField(JNIEnv* env, jobject obj, field_t field, wchar_t& value)   { value = env->GetCharField(obj, field); }
+        void readField(JNIEnv* env, jobject obj, field_t field, short& value)     { value = env->GetShortField(obj, field); }
+        void readField(JNIEnv* env, jobject obj, field_t field, int& value)       { value = env->GetIntField(obj, field); }
+        void readField(JNIEnv* env, jobject obj, field_t field, long long& value) { value = env->GetLongField(obj, field); }
+        void readField(JNIEnv* env, jobject obj, field_t field, long& value)      { value = env->GetLongField(obj, field); }
+        void readField(JNIEnv* env, jobject obj, field_t field, float& value)     { value = env->GetFloatField(obj, field); }
+        void readField(JNIEnv* env, jobject obj, field_t field, double& value)    { value = env->GetDoubleField(obj, field); }
+
+        void writeField(JNIEnv* env, jobject obj, field_t field, bool value)      { env->SetBooleanField(obj, field, value); }
+        void writeField(JNIEnv* env, jobject obj, field_t field, byte_t value)    { env->SetByteField(obj, field, value); }
+        void writeField(JNIEnv* env, jobject obj, field_t field, wchar_t value)   { env->SetCharField(obj, field, value); }
+        void writeField(JNIEnv* env, jobject obj, field_t field, short value)     { env->SetShortField(obj, field, value); }
+        void writeField(JNIEnv* env, jobject obj, field_t field, int value)       { env->SetIntField(obj, field, value); }
+        void writeField(JNIEnv* env, jobject obj, field_t field, long long value) { env->SetLongField(obj, field, value); }
+        void writeField(JNIEnv* env, jobject obj, field_t field, long value)      { env->SetLongField(obj, field, value); }
+        void writeField(JNIEnv* env, jobject obj, field_t field, float value)     { env->SetFloatField(obj, field, value); }
+        void writeField(JNIEnv* env, jobject obj, field_t field, double value)    { env->SetDoubleField(obj, field, value); }
+
+        void readField(JNIEnv* env, jobject obj, field_t field, std::string& value)
+        {
+            value = toString(env->GetObjectField(obj, field));
+        }
+
+        void readField(JNIEnv* env, jobject obj, field_t field, std::wstring& value)
+        {
+            value = toWString(env->GetObjectField(obj, field));
+        }
+
+        void readField(JNIEnv* env, jobject obj, field_t field, Object& value)
+        {
+            value = Object(env->GetObjectField(obj, field), Object::DeleteLocalInput);
+        }
+
+        void writeField(JNIEnv* env, jobject obj, field_t field, const std::string& value)
+        {
+            jobject handle = env->NewStringUTF(value.c_str());
+            env->SetObjectField(obj, field, handle);
+            env->DeleteLocalRef(handle);
+        }
+
+        void writeField(JNIEnv* env, jobject obj, field_t field, const std::wstring& value)
+        {
+#ifdef _WIN32
+            jobject handle = env->NewString((const jchar*) value.c_str(), jsize(value.length()));
+#else
+            auto jstr = toJString(value.c_str(), value.length());
+            jobject handle = env->NewString(jstr.c_str(), jsize(jstr.length()));
+#endif
+            env->SetObjectField(obj, field, handle);
+            env->DeleteLocalRef(handle);
+        }
+
+        void writeField(JNIEnv* env, jobject obj, field_t field, const Object& value)
+        {
+            env->SetObjectField(obj, field, value.getHandle());
+        }
+
+        jobject getObjectElement(JNIEnv* env, jarray array, long index)
+        {
+            return env->GetObjectArrayElement(jobjectArray(array), jsize(index));
+        }
+
+        void deleteLocalRef(JNIEnv* env, jobject ref)
+        {
+            env->DeleteLocalRef(ref);
+        }
+
+        void checkJavaExceptions()
+        {
+            handleJavaExceptions();
+        }
+    }
+
+    /*
+        CallBatch Implementation
+     */
+
+    CallBatch::CallBatch() noexcept
+    {
+    }
+
+    CallBatch::~CallBatch()
+    {
+        clear();
+    }
+
+    void CallBatch::execute()
+    {
+        if (_calls.empty())
+            return;
+
+        JNIEnv* env = jni::env();
+
+        // Holds any local references the JVM creates while running the calls,
+        // including the exception object if one of them fails.
+        LocalFrame frame(env, 16);
+
+        for (std::size_t i = 0; i < _calls.size(); ++i)
+        {
+            const Call& call = _calls[i];
+
+            env->CallVoidMethodA(call.object, call.method, (jvalue*) (_args.data() + call.firstArg));
+
+            if (env->ExceptionCheck())
+            {
+                Object exception(env->ExceptionOccurred(), Object::Temporary);
+
+                env->ExceptionClear();
+                std::string msg = exception.call<std::string>(wellKnown().objectToString);
+                throw CallBatchException(msg.c_str(), i);
+            }
+        }
+    }
+
+    void CallBatch::clear()
+    {
+        if (!_localRefs.empty())
+        {
+            JNIEnv* env = jni::env();
+
+            for (jobject ref : _localRefs)
+                env->DeleteLocalRef(ref);
+        }
+
+        _calls.clear();
+        _args.clear();
+        _localRefs.clear();
+    }
+
     /*
         Vm Implementation
      */
@@ -1569,6 +2909,8 @@ namespace jni
 
 #endif // _WIN32
         }
+
+        wellKnown();
     }
 
     Vm::~Vm()
@@ -1590,19 +2932,7 @@ namespace jni
 
     namespace internal
     {
-        // Base Type Conversions
-        void valueArg(value_t* v, bool a)                   { ((jvalue*) v)->z = jboolean(a); }
-        void valueArg(value_t* v, byte_t a)                 { ((jvalue*) v)->b = a; }
-        void valueArg(value_t* v, wchar_t a)                { ((jvalue*) v)->c = jchar(a); }    // Note: Possible truncation.
-        void valueArg(value_t* v, short a)                  { ((jvalue*) v)->s = a; }
-        void valueArg(value_t* v, int a)                    { ((jvalue*) v)->i = a; }
-        void valueArg(value_t* v, long long a)              { ((jvalue*) v)->j = a; }
-        void valueArg(value_t* v, long a)                   { ((jvalue*) v)->j = a; }
-        void valueArg(value_t* v, float a)                  { ((jvalue*) v)->f = a; }
-        void valueArg(value_t* v, double a)                 { ((jvalue*) v)->d = a; }
-        void valueArg(value_t* v, jobject a)                { ((jvalue*) v)->l = a; }
-        void valueArg(value_t* v, const Object& a)          { ((jvalue*) v)->l = a.getHandle(); }
-        void valueArg(value_t* v, const Object* const& a)   { ((jvalue*) v)->l = a ? a->getHandle() : nullptr; }
+        static_assert(sizeof(value_t) == sizeof(jvalue), "value_t must mirror jvalue");
 
         /*
             Object Implementations
@@ -1629,63 +2959,44 @@ namespace jni
 
         void valueArg(value_t* v, const std::string& a)
         {
-            ((jvalue*) v)->l = env()->NewStringUTF(a.c_str());
-        }
-
-        template <> void cleanupArg<std::string>(value_t* v)
-        {
-            env()->DeleteLocalRef(((jvalue*) v)->l);
+            v->l = env()->NewStringUTF(a.c_str());
         }
 
         void valueArg(value_t* v, const char* a)
         {
-            ((jvalue*) v)->l = env()->NewStringUTF(a);
+            v->l = env()->NewStringUTF(a);
         }
 
-        void valueArg(value_t* v, std::nullptr_t)
-        {
-            ((jvalue*) v)->l = nullptr;
-        }
-
-        template <> void cleanupArg<const char*>(value_t* v)
-        {
-            env()->DeleteLocalRef(((jvalue*) v)->l);
-        }
 #ifdef _WIN32
 
         void valueArg(value_t* v, const std::wstring& a)
         {
-            ((jvalue*) v)->l = env()->NewString((const jchar*) a.c_str(), jsize(a.length()));
+            v->l = env()->NewString((const jchar*) a.c_str(), jsize(a.length()));
         }
 
         void valueArg(value_t* v, const wchar_t* a)
         {
-            ((jvalue*) v)->l = env()->NewString((const jchar*) a, jsize(std::wcslen(a)));
+            v->l = env()->NewString((const jchar*) a, jsize(std::wcslen(a)));
         }
 #else
 
         void valueArg(value_t* v, const std::wstring& a)
         {
             auto jstr = toJString(a.c_str(), a.length());
-            ((jvalue*) v)->l = env()->NewString(jstr.c_str(), jsize(jstr.length()));
+            v->l = env()->NewString(jstr.c_str(), jsize(jstr.length()));
         }
 
         void valueArg(value_t* v, const wchar_t* a)
         {
             auto jstr = toJString(a, std::wcslen(a));
-            ((jvalue*) v)->l = env()->NewString(jstr.c_str(), jsize(jstr.length()));
+            v->l = env()->NewString(jstr.c_str(), jsize(jstr.length()));
         }
 
 #endif
 
-        template <> void cleanupArg<const std::wstring*>(value_t* v)
-        {
-            env()->DeleteLocalRef(((jvalue*) v)->l);
-        }
-
-        template <> void cleanupArg<const wchar_t*>(value_t* v)
+        void cleanupArg(value_t* v)
         {
-            env()->DeleteLocalRef(((jvalue*) v)->l);
+            env()->DeleteLocalRef(v->l);
         }
 
         long getArrayLength(jarray array)
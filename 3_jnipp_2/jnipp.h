@@ -2,9 +2,12 @@
 #define _JNIPP_H_ 1
 
 // Standard Dependencies
+#include <cstddef>
 #include <cstring>
-#include <stdexcept>        // For std::runtime_error
+#include <memory>
+#include <stdexcept>        // For std::runtime_error, std::invalid_argument
 #include <string>
+#include <vector>
 
 // Forward Declarations
 struct JNIEnv_;
@@ -122,25 +125,42 @@ namespace jni
             Argument Conversion
          */
 
-        typedef long long value_t;
-
-        void valueArg(value_t* v, bool a);
-        void valueArg(value_t* v, byte_t a);
-        void valueArg(value_t* v, wchar_t a);
-        void valueArg(value_t* v, short a);
-        void valueArg(value_t* v, int a);
-        void valueArg(value_t* v, long long a);
-        void valueArg(value_t* v, long a);
-        void valueArg(value_t* v, float a);
-        void valueArg(value_t* v, double a);
-        void valueArg(value_t* v, jobject a);
-        void valueArg(value_t* v, const Object& a);
-        void valueArg(value_t* v, const Object* const& a);
+        /*
+            Mirrors the layout of JNI's jvalue, so that an array of these can
+            be handed straight to the Call*MethodA() family.
+         */
+        union value_t
+        {
+            unsigned char z;
+            byte_t b;
+            unsigned short c;
+            short s;
+            int i;
+            long long j;
+            float f;
+            double d;
+            jobject l;
+        };
+
+        // Primitive and reference conversions are inline so that calls taking
+        // only these compile down to a few stores into the argument array.
+        inline void valueArg(value_t* v, bool a)            { v->z = (unsigned char) a; }
+        inline void valueArg(value_t* v, byte_t a)          { v->b = a; }
+        inline void valueArg(value_t* v, wchar_t a)         { v->c = (unsigned short) a; }  // Note: Possible truncation.
+        inline void valueArg(value_t* v, short a)           { v->s = a; }
+        inline void valueArg(value_t* v, int a)             { v->i = a; }
+        inline void valueArg(value_t* v, long long a)       { v->j = a; }
+        inline void valueArg(value_t* v, long a)            { v->j = a; }
+        inline void valueArg(value_t* v, float a)           { v->f = a; }
+        inline void valueArg(value_t* v, double a)          { v->d = a; }
+        inline void valueArg(value_t* v, jobject a)         { v->l = a; }
+        inline void valueArg(value_t* v, std::nullptr_t)    { v->l = nullptr; }
+        inline void valueArg(value_t* v, const Object& a);
+        inline void valueArg(value_t* v, const Object* const& a);
         void valueArg(value_t* v, const std::string& a);
         void valueArg(value_t* v, const char* a);
         void valueArg(value_t* v, const std::wstring& a);
         void valueArg(value_t* v, const wchar_t* a);
-        void valueArg(value_t* v, std::nullptr_t);
 
         inline void args(value_t*) {}
 
@@ -150,32 +170,99 @@ namespace jni
             internal::args(values + 1, args...);
         }
 
-        template <class TArg> void cleanupArg(value_t* /* value */) {}
-        template <>           void cleanupArg<std::string>(value_t* value);
-        template <>           void cleanupArg<std::wstring>(value_t* value);
-        template <>           void cleanupArg<const char*>(value_t* value);
-        template <>           void cleanupArg<const wchar_t*>(value_t* value);
+        /*
+            Whether valueArg() creates a local reference for an argument of
+            the given type, which then has to be released after the call.
+         */
+        template <class TArg> struct NeedsCleanup { static const bool value = false; };
+        template <> struct NeedsCleanup<std::string> { static const bool value = true; };
+        template <> struct NeedsCleanup<std::wstring> { static const bool value = true; };
+        template <> struct NeedsCleanup<const char*> { static const bool value = true; };
+        template <> struct NeedsCleanup<char*> { static const bool value = true; };
+        template <> struct NeedsCleanup<const wchar_t*> { static const bool value = true; };
+        template <> struct NeedsCleanup<wchar_t*> { static const bool value = true; };
+        template <class TArg, size_t n> struct NeedsCleanup<TArg[n]> : NeedsCleanup<const TArg*> {};
+
+        template <class... TArgs> struct AnyNeedsCleanup { static const bool value = false; };
+
+        template <class TArg, class... TArgs>
+        struct AnyNeedsCleanup<TArg, TArgs...>
+        {
+            static const bool value = NeedsCleanup<TArg>::value || AnyNeedsCleanup<TArgs...>::value;
+        };
+
+        void cleanupArg(value_t* value);
 
         template <class TArg = void, class... TArgs>
         void cleanupArgs(value_t* values) {
-            cleanupArg<TArg>(values);
+            if (NeedsCleanup<TArg>::value)
+                cleanupArg(values);
             cleanupArgs<TArgs...>(values + 1);
         }
 
         template <>
         inline void cleanupArgs<void>(value_t* /* values */) {}
 
+        template <class TArg = void, class... TArgs>
+        void collectCleanupArgs(const value_t* values, std::vector<jobject>& refs) {
+            if (NeedsCleanup<TArg>::value)
+                refs.push_back(values->l);
+            collectCleanupArgs<TArgs...>(values + 1, refs);
+        }
+
+        template <>
+        inline void collectCleanupArgs<void>(const value_t* /* values */, std::vector<jobject>& /* refs */) {}
+
+        /*
+            Field Access With A Known Environment
+         */
+
+        void readField(JNIEnv* env, jobject obj, field_t field, bool& value);
+        void readField(JNIEnv* env, jobject obj, field_t field, byte_t& value);
+        void readField(JNIEnv* env, jobject obj, field_t field, wchar_t& value);
+        void readField(JNIEnv* env, jobject obj, field_t field, short& value);
+        void readField(JNIEnv* env, jobject obj, field_t field, int& value);
+        void readField(JNIEnv* env, jobject obj, field_t field, long long& value);
+        void readField(JNIEnv* env, jobject obj, field_t field, long& value);
+        void readField(JNIEnv* env, jobject obj, field_t field, float& value);
+        void readField(JNIEnv* env, jobject obj, field_t field, double& value);
+        void readField(JNIEnv* env, jobject obj, field_t field, std::string& value);
+        void readField(JNIEnv* env, jobject obj, field_t field, std::wstring& value);
+        void readField(JNIEnv* env, jobject obj, field_t field, Object& value);
+
+        void writeField(JNIEnv* env, jobject obj, field_t field, bool value);
+        void writeField(JNIEnv* env, jobject obj, field_t field, byte_t value);
+        void writeField(JNIEnv* env, jobject obj, field_t field, wchar_t value);
+        void writeField(JNIEnv* env, jobject obj, field_t field, short value);
+        void writeField(JNIEnv* env, jobject obj, field_t field, int value);
+        void writeField(JNIEnv* env, jobject obj, field_t field, long long value);
+        void writeField(JNIEnv* env, jobject obj, field_t field, long value);
+        void writeField(JNIEnv* env, jobject obj, field_t field, float value);
+        void writeField(JNIEnv* env, jobject obj, field_t field, double value);
+        void writeField(JNIEnv* env, jobject obj, field_t field, const std::string& value);
+        void writeField(JNIEnv* env, jobject obj, field_t field, const std::wstring& value);
+        void writeField(JNIEnv* env, jobject obj, field_t field, const Object& value);
+
+        jobject getObjectElement(JNIEnv* env, jarray array, long index);
+        void deleteLocalRef(JNIEnv* env, jobject ref);
+        void checkJavaExceptions();
+
+        /*
+            Holds the converted arguments for a single call. The values are
+            written in place by valueArg(), and the destructor only touches
+            the JNI environment when one of the argument types needs cleanup.
+         */
         template <class... TArgs>
         class ArgArray
         {
         public:
             ArgArray(const TArgs&... args) {
-                std::memset(this, 0, sizeof(ArgArray<TArgs...>));
                 internal::args(values, args...);
             }
 
             ~ArgArray() {
-                cleanupArgs<TArgs...>(values);
+                if (AnyNeedsCleanup<TArgs...>::value)
+                    cleanupArgs<TArgs...>(values);
             }
 
             value_t values[sizeof...(TArgs)];
@@ -186,17 +273,16 @@ namespace jni
         class ArgArray<>
         {
         public:
-            ArgArray() {
-                std::memset(this, 0, sizeof(ArgArray<>));
-            }
-
-            ~ArgArray() {
-            }
-
             value_t values[1];
         };
         long getArrayLength(jarray array);
 
+        /* Control block shared between copies of an Object in shared mode. */
+        struct SharedRef;
+
+        /* Canonical, process-wide entry for a Java class and its member IDs. */
+        struct ClassEntry;
+
         /**
          * @brief Used as a tag type for dispatching internally based on return type.
          *
@@ -229,6 +315,72 @@ namespace jni
      */
     JNIEnv* env();
 
+    /**
+        Statistics for the deferred release queue.
+     */
+    struct ReleaseQueueStats
+    {
+        std::size_t depth;              ///< References currently waiting to be released.
+        std::size_t maxDepth;           ///< Largest depth seen.
+        std::size_t released;           ///< Total references released by draining.
+        std::size_t drains;             ///< Number of non-empty drains.
+        long long lastDrainNanoseconds; ///< Time taken by the most recent non-empty drain.
+        long long maxDrainNanoseconds;  ///< Time taken by the slowest drain.
+    };
+
+    /**
+        Enables or disables deferred release of global references. While
+        enabled, destroying or reassigning an Object, Ref or WeakObject does
+        not delete its old global references, weak or not, on the calling
+        thread (nor attach it just for that): they are pushed onto a
+        lock-free queue instead, to be deleted in a batch by
+        drainReleaseQueue(), or by the next thread to create a global
+        reference once enough have accumulated. If the queue cannot
+        allocate, the reference is released immediately instead. Disabling
+        this does not drain the queue.
+        \param enabled `true` to defer releases, `false` to release eagerly.
+     */
+    void setDeferredRelease(bool enabled);
+
+    /**
+        Deletes every global reference waiting in the deferred release
+        queue. The calling thread will be attached to the JVM if necessary.
+        \return The number of references released.
+     */
+    std::size_t drainReleaseQueue();
+
+    /**
+        Gets the current deferred release queue statistics.
+        \return The statistics.
+     */
+    ReleaseQueueStats getReleaseQueueStats();
+
+    /**
+        Statistics for the table of classes shared between Objects.
+     */
+    struct ClassTableStats
+    {
+        std::size_t classes;           ///< Classes in the table, used or idle.
+        std::size_t idleClasses;       ///< Classes no Object uses, kept for reuse.
+        std::size_t classResolutions;  ///< Total classes added to the table.
+        std::size_t memberResolutions; ///< Total method and field IDs looked up in the JVM.
+    };
+
+    /**
+        Releases every class that no Object currently uses, along with its
+        cached method and field IDs. Up to a fixed number of such classes
+        are otherwise kept for reuse, so call this to let go of classes
+        whose ClassLoader should be collected.
+        eturn The number of classes released.
+     */
+    std::size_t purgeClassTable();
+
+    /**
+        Gets the current class table statistics.
+        \return The statistics.
+     */
+    ClassTableStats getClassTableStats();
+
     /**
         Object corresponds with a `java.lang.Object` instance. With an Object,
         you can then call Java methods, and access fields on the Object. To
@@ -241,7 +393,8 @@ namespace jni
         enum ScopeFlags
         {
             Temporary = 1,    ///< Temporary object. Do not create a global reference.
-            DeleteLocalInput = 2     ///< The input reference is temporary and can be deleted.
+            DeleteLocalInput = 2,    ///< The input reference is temporary and can be deleted.
+            Shared = 4    ///< Copies share one reference-counted global reference.
         };
 
         /** Default constructor. Creates a `null` object. */
@@ -250,7 +403,8 @@ namespace jni
         /**
             Copies a reference to another Object. Note that this is not a deep
             copy operation, and both Objects will reference the same Java
-            Object.
+            Object. If the other Object is shared, this only increments its
+            reference count rather than creating a new global reference.
             \param other The Object to copy.
          */
         Object(const Object& other);
@@ -417,13 +571,27 @@ namespace jni
 
         /**
             Tells whether this Object is currently a `null` pointer.
+
+            A global reference owned by this Object is always strong, so only
+            a Temporary Object (which may wrap a weak reference that has since
+            been cleared) needs to ask the JVM.
             \return `true` if `null`, `false` if it references an object.
          */
         bool isNull() const noexcept;
 
+        /**
+            Tells whether the underlying handle is a `null` pointer. Unlike
+            isNull(), this never calls into the JVM, so it will not detect a
+            weak reference whose referent has been collected.
+            \return `true` if the handle is `null`, `false` otherwise.
+         */
+        bool isNullHandle() const noexcept { return _handle == nullptr; }
+
         /**
             Gets a handle for this Object's class. Ideally, this should just return a Class,
-            but C++ won't let us do that that.
+            but C++ won't let us do that that. The handle is a global reference shared by
+            all Objects of the same class, which lives at least as long as any of them
+            (see purgeClassTable()).
             \return The Object's Class's handle.
          */
         jclass getClass() const;
@@ -440,8 +608,25 @@ namespace jni
          */
         jobject makeLocalReference() const;
 
+        /**
+            Creates a shared Object referencing the same Java Object. Copies
+            of a shared Object share a single global reference, counted with
+            an atomic reference count, so copying does not take the VM's
+            global reference lock. The global reference is deleted when the
+            last copy is destroyed.
+            \return The shared Object.
+         */
+        Object makeShared() const;
+
+        /**
+            Tells whether this Object is in shared mode.
+            \return `true` if shared, `false` otherwise.
+         */
+        bool isShared() const noexcept { return _shared != nullptr; }
+
     private:
         // Helper Functions
+        internal::ClassEntry* getClassEntry() const;
         method_t getMethod(const char* name, const char* signature) const;
         method_t getMethod(const char* nameAndSignature) const;
         field_t getField(const char* name, const char* signature) const;
@@ -480,8 +665,235 @@ namespace jni
 
         // Instance Variables
         jobject _handle;
-        mutable jclass _class;
+        mutable internal::ClassEntry* _class;
         bool _isGlobal;
+        internal::SharedRef* _shared;
+
+        friend class Ref;
+        friend class CallBatch;
+    };
+
+    /**
+        A compact, non-polymorphic owning reference to a Java Object. It is
+        the size of a single pointer: it always holds a global reference (or
+        `null`), and does not cache the Object's class. Use it in place of
+        Object when storing large numbers of references, and convert back to
+        an Object to call methods or access fields.
+     */
+    class Ref
+    {
+    public:
+        /** Default constructor. Creates a `null` reference. */
+        Ref() noexcept : _handle(nullptr) {}
+
+        /**
+            Copies a reference to another Ref. Both will reference the same
+            Java Object.
+            \param other The Ref to copy.
+         */
+        Ref(const Ref& other);
+
+        /**
+            Move constructor. Takes the reference from the supplied Ref, and
+            then nulls the supplied Ref.
+            \param other The Ref to move.
+         */
+        Ref(Ref&& other) noexcept : _handle(other._handle) { other._handle = nullptr; }
+
+        /**
+            Creates a Ref to the same Java Object as the given Object.
+            \param object The Object to reference.
+         */
+        explicit Ref(const Object& object);
+
+        /**
+            Creates a Ref from an Object. If the Object owns a global
+            reference, it is taken over without creating a new one.
+            \param object The Object to take the reference from.
+         */
+        explicit Ref(Object&& object);
+
+        /**
+            Destructor. Releases the global reference.
+         */
+        ~Ref() noexcept;
+
+        /**
+            Assignment operator. Both Refs will reference the same Java Object.
+            \param other The Ref to copy.
+         */
+        Ref& operator=(const Ref& other);
+
+        /**
+            Assignment operator. Takes the reference from the supplied Ref.
+            \param other The Ref to move.
+         */
+        Ref& operator=(Ref&& other) noexcept;
+
+        /**
+            Checks whether two Refs point to the same Java Object.
+            \param other The Ref to compare with.
+            \return `true` if the same, `false` otherwise.
+         */
+        bool operator==(const Ref& other) const;
+
+        /**
+            Checks whether two Refs point to different Java Objects.
+            \param other The Ref to compare with.
+            \return `true` if different, `false` otherwise.
+         */
+        bool operator!=(const Ref& other) const { return !operator==(other); }
+
+        /**
+            Tells whether this Ref is `null`. As the held reference is always
+            a strong global reference, this is a simple pointer check.
+            \return `true` if `null`, `false` otherwise.
+         */
+        bool isNull() const noexcept { return _handle == nullptr; }
+
+        /**
+            Gets the underlying JNI jobject handle.
+            \return The handle.
+         */
+        jobject getHandle() const noexcept { return _handle; }
+
+        /**
+            Creates an Object holding its own global reference to the same
+            Java Object.
+            \return The new Object.
+         */
+        Object toObject() const;
+
+        /**
+            Creates a temporary Object which shares this Ref's handle rather
+            than creating a new reference. It must not outlive this Ref.
+            \return The temporary Object.
+         */
+        Object borrow() const { return Object(_handle, Object::Temporary); }
+
+    private:
+        // Instance Variables
+        jobject _handle;
+    };
+
+    /**
+        A weak global reference to a Java Object. It does not prevent the
+        Object from being garbage collected; use lock() to obtain a usable
+        Object for as long as it is needed.
+
+        The Object's identity hash code is captured on construction, so
+        comparing two WeakObjects referring to different Java Objects rarely
+        needs to call into the JVM.
+     */
+    class WeakObject
+    {
+    public:
+        /** Default constructor. Creates a `null` reference. */
+        WeakObject() noexcept : _handle(nullptr), _hash(0) {}
+
+        /**
+            Creates a weak reference to the given Object.
+            \param object The Object to reference.
+         */
+        WeakObject(const Object& object);
+
+        /**
+            Copies another WeakObject. Both will reference the same Java
+            Object, if it is still alive.
+            \param other The WeakObject to copy.
+         */
+        WeakObject(const WeakObject& other);
+
+        /**
+            Move constructor. Takes the reference from the supplied
+            WeakObject, and then nulls the supplied WeakObject.
+            \param other The WeakObject to move.
+         */
+        WeakObject(WeakObject&& other) noexcept : _handle(other._handle), _hash(other._hash) { other._handle = nullptr; }
+
+        /**
+            Destructor. Releases the weak global reference.
+         */
+        ~WeakObject() noexcept;
+
+        /**
+            Assignment operator. Both will reference the same Java Object.
+            \param other The WeakObject to copy.
+         */
+        WeakObject& operator=(const WeakObject& other);
+
+        /**
+            Assignment operator. Takes the reference from the supplied
+            WeakObject.
+            \param other The WeakObject to move.
+         */
+        WeakObject& operator=(WeakObject&& other) noexcept;
+
+        /**
+            Checks whether two WeakObjects refer to the same Java Object.
+            Two WeakObjects whose referents have both been collected compare
+            equal only if they had the same identity hash code.
+            \param other The WeakObject to compare with.
+            \return `true` if the same, `false` otherwise.
+         */
+        bool operator==(const WeakObject& other) const;
+
+        /**
+            Checks whether two WeakObjects refer to different Java Objects.
+            \param other The WeakObject to compare with.
+            \return `true` if different, `false` otherwise.
+         */
+        bool operator!=(const WeakObject& other) const { return !operator==(other); }
+
+        /**
+            Checks whether this refers to the same Java Object as an Object.
+            \param other The Object to compare with.
+            \return `true` if the same, `false` otherwise.
+         */
+        bool operator==(const Object& other) const;
+
+        /**
+            Checks whether this refers to a different Java Object than an
+            Object.
+            \param other The Object to compare with.
+            \return `true` if different, `false` otherwise.
+         */
+        bool operator!=(const Object& other) const { return !operator==(other); }
+
+        /**
+            Tells whether the referenced Java Object has been garbage
+            collected (or this was never assigned one).
+            \return `true` if expired, `false` if the Object is still alive.
+         */
+        bool expired() const noexcept;
+
+        /**
+            Gets a strong reference to the Java Object, if it is still alive.
+            \param scopeFlags Object::Temporary to return an Object holding a
+                   new local reference, which lives until the current native
+                   frame returns, rather than a global reference.
+            \return The Object, or a `null` Object if it has been collected.
+         */
+        Object lock(int scopeFlags = 0) const;
+
+        /**
+            Gets the identity hash code of the referenced Java Object, as
+            captured when this reference was created. Suitable for use as a
+            hash key, along with operator==.
+            \return The identity hash code, or 0 if `null`.
+         */
+        int hashCode() const noexcept { return _hash; }
+
+        /**
+            Gets the underlying JNI jweak handle.
+            \return The handle.
+         */
+        jobject getHandle() const noexcept { return _handle; }
+
+    private:
+        // Instance Variables
+        jobject _handle;
+        int _hash;
     };
 
     /**
@@ -516,6 +928,12 @@ namespace jni
          */
         bool isNull() const noexcept { return Object::isNull(); }
 
+        /**
+            Tells whether the underlying handle is a `null` pointer.
+            \return `true` if null, `false` otherwise.
+         */
+        bool isNullHandle() const noexcept { return Object::isNullHandle(); }
+
         /**
             Creates a new instance of this Java class and returns a reference to
             it. The item's parameterless constructor is called.
@@ -836,6 +1254,38 @@ namespace jni
         Object newObject(method_t constructor, internal::value_t* args) const;
     };
 
+    /**
+        Classes which jnipp resolves once, during init() or Vm construction,
+        and keeps referenced for the lifetime of the process.
+     */
+    enum WellKnownClass
+    {
+        ObjectClass,
+        StringClass,
+        ThrowableClass,
+        ClassClass,
+        ByteBufferClass,
+        SystemClass,
+        BooleanClass,
+        ByteClass,
+        CharacterClass,
+        ShortClass,
+        IntegerClass,
+        LongClass,
+        FloatClass,
+        DoubleClass,
+        WellKnownClassCount    ///< Number of well-known classes. Not a class.
+    };
+
+    /**
+        Gets one of the well-known classes. This is much cheaper than
+        constructing a Class by name, which has to search the class loader
+        and create a new global reference every time.
+        \param which The class to retrieve.
+        \return The Class, which remains valid for the lifetime of the process.
+     */
+    const Class& getWellKnownClass(WellKnownClass which);
+
     /**
         Convenience class for dealing with Java enums.
      */
@@ -896,6 +1346,15 @@ namespace jni
          */
         Array(long length, const Class& type);
 
+        /**
+            Creates an Array holding a copy of the given values. The whole
+            conversion is batched, with a single Java exception check at the
+            end, which makes this much faster than calling setElement() for
+            each index.
+            \param values The values to copy into the new Array.
+         */
+        Array(const std::vector<TElement>& values);
+
         /**
             Copy constructor. Shares a reference to the Java array with the
             copied Array object.
@@ -955,6 +1414,33 @@ namespace jni
         TElement getElement(long index) const;
         TElement operator[](long index) const { return getElement(index); }
 
+        /**
+            Copies the entire contents of this Array into a std::vector. The
+            whole conversion is batched, with a single Java exception check at
+            the end, which makes this much faster than calling getElement()
+            for each index.
+            \return The Array contents.
+         */
+        std::vector<TElement> toVector() const;
+
+        /**
+            Copies a range of elements out of this Array into a C++ buffer,
+            with a single JNI call. Only available for primitive element types.
+            \param start The index of the first element to copy.
+            \param length The number of elements to copy.
+            \param values The buffer to copy into, with room for `length` elements.
+         */
+        void getRegion(long start, long length, TElement* values) const;
+
+        /**
+            Copies a range of elements from a C++ buffer into this Array, with
+            a single JNI call. Only available for primitive element types.
+            \param start The index of the first element to overwrite.
+            \param length The number of elements to copy.
+            \param values The buffer to copy from, holding `length` elements.
+         */
+        void setRegion(long start, long length, const TElement* values);
+
         /**
             Gets the length of this Array.
             \return The array length.
@@ -972,6 +1458,458 @@ namespace jni
         mutable long _length;   ///< Mutable as it may only finally get set in a getLength() call.
     };
 
+    /**
+        Maintains a JNI local reference frame for the current thread. Every
+        local reference created while the LocalFrame is alive is released when
+        it is destroyed, so loops which create many temporary references do
+        not need to delete each of them, and cannot overflow the local
+        reference table.
+     */
+    class LocalFrame final
+    {
+    public:
+        /**
+            Pushes a new local reference frame.
+            \param capacity The number of local references the frame must hold.
+         */
+        explicit LocalFrame(int capacity = 16);
+
+        /**
+            Pushes a new local reference frame, using an environment which the
+            caller has already looked up.
+            \param env The JNI environment for the current thread.
+            \param capacity The number of local references the frame must hold.
+         */
+        LocalFrame(JNIEnv* env, int capacity);
+
+        /** Pops the frame, releasing its local references. */
+        ~LocalFrame();
+
+        // Frames must be popped in the order they were pushed.
+        LocalFrame(const LocalFrame&) = delete;
+        LocalFrame& operator=(const LocalFrame&) = delete;
+
+    private:
+        // Instance Variables
+        JNIEnv* _env;
+    };
+
+    /**
+        Records a sequence of `void` method calls, on one or more Objects, and
+        runs them together. The arguments are converted when each call is
+        added, and execute() then issues the calls back to back with a single
+        JNI environment lookup and local reference frame, checking only for a
+        pending Java exception between calls.
+
+        This is intended for runs of setters on the same object, where the
+        per-call overhead dominates the work done in Java. The Objects passed
+        to add() must outlive the batch, and a batch must be executed on the
+        thread that built it.
+     */
+    class CallBatch final
+    {
+    public:
+        /** Creates an empty batch. */
+        CallBatch() noexcept;
+
+        /** Releases any references created while converting arguments. */
+        ~CallBatch();
+
+        // Copying would duplicate the converted argument references.
+        CallBatch(const CallBatch&) = delete;
+        CallBatch& operator=(const CallBatch&) = delete;
+
+        /**
+            Records a call of the given method on an Object. The method must
+            return `void`.
+            \param obj The Object to call the method on.
+            \param method The method to call.
+            \param args Arguments to supply to the method.
+            \return This batch, for chaining.
+         */
+        template <class... TArgs>
+        CallBatch& add(const Object& obj, method_t method, const TArgs&... args) {
+            std::size_t first = _args.size();
+            _args.resize(first + sizeof...(TArgs));
+            internal::args(_args.data() + first, args...);
+            internal::collectCleanupArgs<TArgs...>(_args.data() + first, _localRefs);
+            _calls.push_back(Call{ obj.getHandle(), method, first });
+            return *this;
+        }
+
+        /**
+            Records a call of the method with the given name on an Object. If
+            no signature is supplied, one is generated from the argument
+            types, with a `void` return type.
+            \param obj The Object to call the method on.
+            \param name The name of the method to call (and optional signature).
+            \param args Arguments to supply to the method.
+            \return This batch, for chaining.
+         */
+        template <class... TArgs>
+        CallBatch& add(const Object& obj, const char* name, const TArgs&... args) {
+            if (std::strchr(name, '('))
+                return add(obj, obj.getMethod(name), args...);
+
+            std::string sig = "(" + internal::sig(args...) + ")V";
+            return add(obj, obj.getMethod(name, sig.c_str()), args...);
+        }
+
+        /**
+            Runs every recorded call, in the order they were added. If a call
+            throws a Java exception, the remaining calls are skipped and a
+            CallBatchException identifying the failed call is thrown. The
+            recorded calls are kept, so the batch can be executed again.
+         */
+        void execute();
+
+        /**
+            Discards every recorded call.
+         */
+        void clear();
+
+        /**
+            Gets the number of recorded calls.
+            \return The number of calls.
+         */
+        std::size_t size() const noexcept { return _calls.size(); }
+
+    private:
+        struct Call
+        {
+            jobject object;
+            method_t method;
+            std::size_t firstArg;
+        };
+
+        // Instance Variables
+        std::vector<Call> _calls;
+        std::vector<internal::value_t> _args;
+        std::vector<jobject> _localRefs;
+    };
+
+    /**
+        Maps fields of a Java class onto the members of a C++ struct, so that
+        a whole object can be read into (or written from) the struct at once.
+        The field IDs are resolved when each mapping is added, and reading or
+        writing then runs through every field with a single JNI environment
+        lookup. This makes it cheap to take snapshots of small value objects.
+
+        A FieldSet is typically built once and kept in a static:
+
+            struct Point { int x; int y; };
+
+            static const jni::FieldSet<Point> fields = [] {
+                jni::FieldSet<Point> set("java/awt/Point");
+                set.add("x", &Point::x).add("y", &Point::y);
+                return set;
+            }();
+
+            Point p = fields.read(obj);
+     */
+    template <class TStruct>
+    class FieldSet
+    {
+    public:
+        /**
+            Creates an empty FieldSet for the given class.
+            \param cls The Java class which declares the fields.
+         */
+        FieldSet(const Class& cls) : _class(cls) {}
+
+        /**
+            Creates an empty FieldSet for the class with the given name.
+            \param name The JNI-formatted name of the class.
+         */
+        FieldSet(const char* name) : _class(name) {}
+
+        /**
+            Maps a Java field onto a struct member. The field signature is
+            derived from the member type, which must be a primitive type,
+            std::string, std::wstring or jni::Object (for `java.lang.Object`
+            fields; use the other overload for other reference types).
+            \param name The name of the Java field.
+            \param member The struct member to map it onto.
+            \return This FieldSet, for chaining.
+         */
+        template <class TField>
+        FieldSet& add(const char* name, TField TStruct::* member) {
+            return add(name, member, internal::valueSig((TField*) nullptr).c_str());
+        }
+
+        /**
+            Maps a Java field with an explicit signature onto a struct member.
+            \param name The name of the Java field.
+            \param member The struct member to map it onto.
+            \param signature The JNI field signature.
+            \return This FieldSet, for chaining.
+         */
+        template <class TField>
+        FieldSet& add(const char* name, TField TStruct::* member, const char* signature) {
+            field_t field = _class.getField(name, signature);
+            _fields.push_back(std::unique_ptr<FieldBase>(new Field<TField>(field, member)));
+            return *this;
+        }
+
+        /**
+            Reads every mapped field of the given Object into a struct.
+            \param obj The Object to read, which must be an instance of the class.
+            \param value The struct to fill in.
+         */
+        void read(const Object& obj, TStruct& value) const {
+            JNIEnv* env = jni::env();
+            jobject handle = obj.getHandle();
+
+            for (const auto& field : _fields)
+                field->read(env, handle, value);
+        }
+
+        /**
+            Reads every mapped field of the given Object into a new struct.
+            Members without a mapping are value-initialised.
+            \param obj The Object to read, which must be an instance of the class.
+            \return The filled in struct.
+         */
+        TStruct read(const Object& obj) const {
+            TStruct value = TStruct();
+            read(obj, value);
+            return value;
+        }
+
+        /**
+            Writes every mapped member of a struct into the fields of the
+            given Object.
+            \param obj The Object to write, which must be an instance of the class.
+            \param value The struct to copy from.
+         */
+        void write(const Object& obj, const TStruct& value) const {
+            JNIEnv* env = jni::env();
+            jobject handle = obj.getHandle();
+
+            for (const auto& field : _fields)
+                field->write(env, handle, value);
+        }
+
+        /**
+            Gets the number of mapped fields.
+            \return The number of fields.
+         */
+        std::size_t size() const noexcept { return _fields.size(); }
+
+    private:
+        struct FieldBase
+        {
+            explicit FieldBase(field_t id) : id(id) {}
+            virtual ~FieldBase() {}
+            virtual void read(JNIEnv* env, jobject obj, TStruct& value) const = 0;
+            virtual void write(JNIEnv* env, jobject obj, const TStruct& value) const = 0;
+
+            field_t id;
+        };
+
+        template <class TField>
+        struct Field final : FieldBase
+        {
+            Field(field_t id, TField TStruct::* member) : FieldBase(id), member(member) {}
+
+            void read(JNIEnv* env, jobject obj, TStruct& value) const override {
+                internal::readField(env, obj, this->id, value.*member);
+            }
+
+            void write(JNIEnv* env, jobject obj, const TStruct& value) const override {
+                internal::writeField(env, obj, this->id, value.*member);
+            }
+
+            TField TStruct::* member;
+        };
+
+        // Instance Variables
+        Class _class;
+        std::vector<std::unique_ptr<FieldBase>> _fields;
+    };
+
+    /**
+        The structure-of-arrays counterpart of FieldSet: maps Java fields onto
+        `std::vector` members of a C++ struct, one vector (column) per field.
+        This is used to copy a whole array of small value objects into
+        contiguous C++ data, or back again.
+
+            struct Points { std::vector<int> x; std::vector<int> y; };
+
+            jni::FieldColumns<Points> columns("java/awt/Point");
+            columns.add("x", &Points::x).add("y", &Points::y);
+
+            Points points;
+            columns.gather(array, points);
+
+        Both gather() and scatter() use a single JNI environment lookup, hold
+        only one local reference to an element at a time, and check for Java
+        exceptions once at the end.
+     */
+    template <class TColumns>
+    class FieldColumns
+    {
+    public:
+        /**
+            Creates an empty FieldColumns for the given class.
+            \param cls The Java class which declares the fields.
+         */
+        FieldColumns(const Class& cls) : _class(cls) {}
+
+        /**
+            Creates an empty FieldColumns for the class with the given name.
+            \param name The JNI-formatted name of the class.
+         */
+        FieldColumns(const char* name) : _class(name) {}
+
+        /**
+            Maps a Java field onto a column. The field signature is derived
+            from the element type, as for FieldSet::add(). Object columns
+            hold a global reference per entry, since they outlive the call;
+            every other local reference is released as each element is done.
+            \param name The name of the Java field.
+            \param column The vector member to map it onto.
+            \return This FieldColumns, for chaining.
+         */
+        template <class TField>
+        FieldColumns& add(const char* name, std::vector<TField> TColumns::* column) {
+            return add(name, column, internal::valueSig((TField*) nullptr).c_str());
+        }
+
+        /**
+            Maps a Java field with an explicit signature onto a column.
+            \param name The name of the Java field.
+            \param column The vector member to map it onto.
+            \param signature The JNI field signature.
+            \return This FieldColumns, for chaining.
+         */
+        template <class TField>
+        FieldColumns& add(const char* name, std::vector<TField> TColumns::* column, const char* signature) {
+            field_t field = _class.getField(name, signature);
+            _columns.push_back(std::unique_ptr<ColumnBase>(new Column<TField>(field, column)));
+            return *this;
+        }
+
+        /**
+            Reads the mapped fields of every element of the given Array. Each
+            column is resized to the Array length; entries for `null`
+            elements are value-initialised.
+            \param array The Array of objects, which must be instances of the class.
+            \param columns The struct whose columns are filled in.
+         */
+        void gather(const Array<Object>& array, TColumns& columns) const {
+            long length = array.getLength();
+
+            for (const auto& column : _columns)
+                column->resize(columns, std::size_t(length));
+
+            JNIEnv* env = jni::env();
+
+            for (long i = 0; i < length; ++i)
+            {
+                jobject element = internal::getObjectElement(env, array.getHandle(), i);
+
+                if (element != nullptr)
+                {
+                    for (const auto& column : _columns)
+                        column->read(env, element, columns, std::size_t(i));
+
+                    internal::deleteLocalRef(env, element);
+                }
+
+                // Stop at the first failure, before making any more JNI calls.
+                internal::checkJavaExceptions();
+            }
+        }
+
+        /**
+            Writes every column into the mapped fields of the elements of the
+            given Array. Each column must hold at least as many entries as
+            the Array has elements; `null` elements are skipped.
+            \param array The Array of objects, which must be instances of the class.
+            \param columns The struct whose columns are copied from.
+            \throws std::invalid_argument If a column is shorter than the Array.
+         */
+        void scatter(const Array<Object>& array, const TColumns& columns) const {
+            long length = array.getLength();
+
+            for (const auto& column : _columns)
+            {
+                if (column->size(columns) < std::size_t(length))
+                    throw std::invalid_argument("FieldColumns::scatter: column shorter than the array");
+            }
+
+            JNIEnv* env = jni::env();
+
+            for (long i = 0; i < length; ++i)
+            {
+                jobject element = internal::getObjectElement(env, array.getHandle(), i);
+
+                if (element != nullptr)
+                {
+                    for (const auto& column : _columns)
+                        column->write(env, element, columns, std::size_t(i));
+
+                    internal::deleteLocalRef(env, element);
+                }
+
+                // Stop at the first failure, before making any more JNI calls.
+                internal::checkJavaExceptions();
+            }
+        }
+
+        /**
+            Gets the number of mapped columns.
+            \return The number of columns.
+         */
+        std::size_t size() const noexcept { return _columns.size(); }
+
+    private:
+        struct ColumnBase
+        {
+            explicit ColumnBase(field_t id) : id(id) {}
+            virtual ~ColumnBase() {}
+            virtual std::size_t size(const TColumns& columns) const = 0;
+            virtual void resize(TColumns& columns, std::size_t length) const = 0;
+            virtual void read(JNIEnv* env, jobject obj, TColumns& columns, std::size_t index) const = 0;
+            virtual void write(JNIEnv* env, jobject obj, const TColumns& columns, std::size_t index) const = 0;
+
+            field_t id;
+        };
+
+        template <class TField>
+        struct Column final : ColumnBase
+        {
+            Column(field_t id, std::vector<TField> TColumns::* column) : ColumnBase(id), column(column) {}
+
+            std::size_t size(const TColumns& columns) const override {
+                return (columns.*column).size();
+            }
+
+            void resize(TColumns& columns, std::size_t length) const override {
+                (columns.*column).assign(length, TField());
+            }
+
+            // Goes through a temporary so that std::vector<bool> works too.
+            void read(JNIEnv* env, jobject obj, TColumns& columns, std::size_t index) const override {
+                TField value;
+                internal::readField(env, obj, this->id, value);
+                (columns.*column)[index] = value;
+            }
+
+            void write(JNIEnv* env, jobject obj, const TColumns& columns, std::size_t index) const override {
+                const TField value = (columns.*column)[index];
+                internal::writeField(env, obj, this->id, value);
+            }
+
+            std::vector<TField> TColumns::* column;
+        };
+
+        // Instance Variables
+        Class _class;
+        std::vector<std::unique_ptr<ColumnBase>> _columns;
+    };
+
     /**
         When the application's entry point is in C++ rather than in Java, it will
         need to spin up its own instance of the Java Virtual Machine (JVM) before
@@ -1010,6 +1948,31 @@ namespace jni
         InvocationException(const char* msg = "Java Exception detected") : Exception(msg) {}
     };
 
+    /**
+        A method call recorded in a CallBatch threw an Exception.
+     */
+    class CallBatchException : public InvocationException
+    {
+    public:
+        /**
+            Constructor with an error message.
+            \param msg Message to pass to the Exception.
+            \param index The position of the failed call within the batch.
+         */
+        CallBatchException(const char* msg, std::size_t index) : InvocationException(msg), _index(index) {}
+
+        /**
+            Gets the position of the failed call within the batch. The calls
+            before it completed; the calls after it were not run.
+            \return The zero-based index of the failed call.
+         */
+        std::size_t getIndex() const noexcept { return _index; }
+
+    private:
+        // Instance Variables
+        std::size_t _index;
+    };
+
     /**
         A supplied name or type signature could not be resolved.
      */
@@ -1036,6 +1999,16 @@ namespace jni
         InitializationException(const char* msg) : Exception(msg) {}
     };
 
+    /*
+        Object Argument Conversion
+     */
+
+    namespace internal
+    {
+        inline void valueArg(value_t* v, const Object& a)           { v->l = a.getHandle(); }
+        inline void valueArg(value_t* v, const Object* const& a)    { v->l = a ? a->getHandle() : nullptr; }
+    }
+
     /*
         Call method returning array: implementation
     */
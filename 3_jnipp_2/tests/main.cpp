@@ -77,6 +77,15 @@ TEST(Class_getName)
     ASSERT(cls.getName() == "java.lang.String");
 }
 
+TEST(Class_wellKnown)
+{
+    const jni::Class& str = jni::getWellKnownClass(jni::StringClass);
+
+    ASSERT(str.getName() == "java.lang.String");
+    ASSERT(&str == &jni::getWellKnownClass(jni::StringClass));
+    ASSERT(jni::getWellKnownClass(jni::IntegerClass).getName() == "java.lang.Integer");
+}
+
 TEST(Class_getParent)
 {
     jni::Class parent = jni::Class("java/lang/Integer").getParent();
@@ -211,6 +220,98 @@ TEST(Object_defaultConstructor_isNull)
     ASSERT(o.isNull());
 }
 
+TEST(Object_isNullHandle)
+{
+    jni::Object a;
+    jni::Object b = jni::Class("java/lang/String").newInstance("Testing");
+    jni::Object c(b.getHandle(), jni::Object::Temporary);
+
+    ASSERT(a.isNullHandle());
+    ASSERT(!b.isNullHandle());
+    ASSERT(!b.isNull());
+    ASSERT(!c.isNullHandle());
+    ASSERT(!c.isNull());
+}
+
+TEST(Object_makeShared)
+{
+    jni::Object str = jni::Class("java/lang/String").newInstance("Testing");
+    jni::Object shared = str.makeShared();
+
+    ASSERT(!str.isShared());
+    ASSERT(shared.isShared());
+    ASSERT(shared == str);
+
+    jni::Object copy(shared);
+    ASSERT(copy.isShared());
+    ASSERT(copy.getHandle() == shared.getHandle());
+
+    shared = jni::Object();
+    ASSERT(copy.call<std::string>("toString") == "Testing");
+}
+
+TEST(Object_deferredRelease)
+{
+    jni::drainReleaseQueue();
+
+    {
+        jni::Object a = jni::Class("java/lang/String").newInstance("a");
+        jni::Object b = jni::Class("java/lang/String").newInstance("b");
+
+        jni::setDeferredRelease(true);
+    }
+
+    jni::setDeferredRelease(false);
+
+    ASSERT(jni::getReleaseQueueStats().depth == 2);
+    ASSERT(jni::drainReleaseQueue() == 2);
+
+    jni::ReleaseQueueStats stats = jni::getReleaseQueueStats();
+    ASSERT(stats.depth == 0);
+    ASSERT(stats.maxDepth >= 2);
+    ASSERT(stats.released >= 2);
+
+    // Assignment drops the old reference the same way.
+    {
+        jni::Object a = jni::Class("java/lang/String").newInstance("a");
+        jni::Object b = jni::Class("java/lang/String").newInstance("b");
+        jni::Object c = jni::Class("java/lang/String").newInstance("c");
+
+        jni::setDeferredRelease(true);
+
+        a = b;
+        b = std::move(c);
+        ASSERT(jni::getReleaseQueueStats().depth == 2);
+
+        jni::setDeferredRelease(false);
+
+        jni::Ref ra(a);
+        jni::Ref rb(b);
+        jni::Ref rc(c);
+
+        jni::setDeferredRelease(true);
+
+        ra = rb;
+        rb = std::move(rc);
+        ASSERT(jni::getReleaseQueueStats().depth == 4);
+
+        jni::setDeferredRelease(false);
+    }
+
+    ASSERT(jni::drainReleaseQueue() == 4);
+}
+
+TEST(Object_getClass_shared)
+{
+    jni::Object a = jni::Class("java/lang/String").newInstance("a");
+    jni::Object b = jni::Class("java/lang/String").newInstance("b");
+
+    ASSERT(a.getClass() != nullptr);
+    ASSERT(a.getClass() == b.getClass());
+    ASSERT(a.call<int>("length") == 1);
+    ASSERT(b.call<int>("length") == 1);
+}
+
 TEST(Object_copyConstructorIsSameObject)
 {
     jni::Object a = jni::Class("java/lang/String").newInstance();
@@ -332,6 +433,172 @@ TEST(Object_makeLocalReference)
     ASSERT(str == fromLocal);
 }
 
+TEST(LocalFrame_releasesLocalReferences)
+{
+    jni::Object str = jni::Class("java/lang/String").newInstance("Testing");
+
+    // Far more local references than the JVM guarantees, but never more
+    // than one alive at a time.
+    for (int i = 0; i < 100000; ++i)
+    {
+        jni::LocalFrame frame(1);
+        jni::jobject local = str.makeLocalReference();
+        ASSERT(local != nullptr);
+    }
+
+    ASSERT(!str.isNull());
+}
+
+/*
+    jni::Ref Tests
+ */
+
+TEST(Ref_defaultConstructor_isNull)
+{
+    jni::Ref ref;
+
+    ASSERT(ref.isNull());
+    ASSERT(sizeof(jni::Ref) == sizeof(jni::jobject));
+}
+
+TEST(Ref_fromObject)
+{
+    jni::Object str = jni::Class("java/lang/String").newInstance("Testing");
+    jni::Ref ref(str);
+
+    ASSERT(!ref.isNull());
+    ASSERT(!str.isNull());
+    ASSERT(ref.toObject() == str);
+    ASSERT(ref.borrow().call<std::string>("toString") == "Testing");
+}
+
+TEST(Ref_fromObject_move)
+{
+    jni::Object str = jni::Class("java/lang/String").newInstance("Testing");
+    jni::jobject handle = str.getHandle();
+    jni::Ref ref(std::move(str));
+
+    ASSERT(ref.getHandle() == handle);
+    ASSERT(str.isNull());
+}
+
+TEST(Ref_copyConstructorIsSameObject)
+{
+    jni::Ref a(jni::Class("java/lang/String").newInstance("Testing"));
+    jni::Ref b(a);
+
+    ASSERT(a == b);
+    ASSERT(a.getHandle() != b.getHandle());
+}
+
+/*
+    jni::WeakObject Tests
+ */
+
+TEST(Object_getClass_reusedAfterLastUser)
+{
+    jni::Class arrayList("java/util/ArrayList");
+    jni::jclass first;
+
+    {
+        jni::Object list = arrayList.newInstance();
+
+        ASSERT(list.call<int>("size") == 0);
+        first = list.getClass();
+    }
+
+    // No ArrayList is left, but its entry and method IDs are kept.
+    jni::ClassTableStats before = jni::getClassTableStats();
+    ASSERT(before.idleClasses >= 1);
+
+    {
+        jni::Object list = arrayList.newInstance();
+
+        ASSERT(list.call<int>("size") == 0);
+        ASSERT(list.getClass() == first);
+    }
+
+    jni::ClassTableStats after = jni::getClassTableStats();
+    ASSERT(after.classResolutions == before.classResolutions);
+    ASSERT(after.memberResolutions == before.memberResolutions);
+}
+
+TEST(purgeClassTable_releasesIdleClasses)
+{
+    {
+        jni::Object list = jni::Class("java/util/ArrayList").newInstance();
+
+        ASSERT(list.call<int>("size") == 0);
+    }
+
+    jni::Object str = jni::Class("java/lang/String").newInstance("a");
+    ASSERT(str.call<int>("length") == 1);
+
+    ASSERT(jni::purgeClassTable() >= 1);
+
+    // Classes in use stay put.
+    jni::ClassTableStats stats = jni::getClassTableStats();
+    ASSERT(stats.idleClasses == 0);
+    ASSERT(stats.classes >= 1);
+    ASSERT(str.call<int>("length") == 1);
+
+    // A purged class is looked up again when needed.
+    jni::Object list = jni::Class("java/util/ArrayList").newInstance();
+    jni::Object element = jni::Class("java/lang/String").newInstance("b");
+
+    ASSERT(list.call<bool>("add", element));
+    ASSERT(jni::getClassTableStats().classResolutions == stats.classResolutions + 1);
+}
+
+TEST(WeakObject_defaultConstructor_isExpired)
+{
+    jni::WeakObject weak;
+
+    ASSERT(weak.expired());
+    ASSERT(weak.lock().isNull());
+}
+
+TEST(WeakObject_lock)
+{
+    jni::Object str = jni::Class("java/lang/String").newInstance("Testing");
+    jni::WeakObject weak(str);
+
+    ASSERT(!weak.expired());
+    ASSERT(weak == str);
+    ASSERT(weak.lock() == str);
+    ASSERT(weak.lock(jni::Object::Temporary).call<std::string>("toString") == "Testing");
+}
+
+TEST(WeakObject_compare)
+{
+    jni::Object a = jni::Class("java/lang/String").newInstance("a");
+    jni::Object b = jni::Class("java/lang/String").newInstance("b");
+    jni::WeakObject weakA(a);
+    jni::WeakObject weakB(b);
+    jni::WeakObject copyA(weakA);
+
+    ASSERT(weakA == copyA);
+    ASSERT(weakA.hashCode() == copyA.hashCode());
+    ASSERT(weakA != weakB);
+}
+
+TEST(WeakObject_deferredRelease)
+{
+    jni::Object str = jni::Class("java/lang/String").newInstance("Testing");
+    jni::drainReleaseQueue();
+
+    {
+        jni::WeakObject weak(str);
+
+        jni::setDeferredRelease(true);
+    }
+
+    jni::setDeferredRelease(false);
+
+    ASSERT(jni::getReleaseQueueStats().depth == 1);
+    ASSERT(jni::drainReleaseQueue() == 1);
+}
+
 /*
     jni::Enum Tests
  */
@@ -497,6 +764,112 @@ TEST(Array_setElement_indexException)
     }
 }
 
+TEST(Array_toVector_basicType)
+{
+    jni::Array<int> a(10);
+
+    for (int i = 0; i < 10; i++)
+        a.setElement(i, i * 2);
+
+    std::vector<int> values = a.toVector();
+
+    ASSERT(values.size() == 10);
+
+    for (int i = 0; i < 10; i++)
+        ASSERT(values[i] == i * 2);
+}
+
+TEST(Array_toVector_string)
+{
+    jni::Array<std::string> a(1000);
+
+    for (int i = 0; i < 1000; i++)
+        a.setElement(i, std::to_string(i));
+
+    std::vector<std::string> values = a.toVector();
+    std::vector<std::wstring> wvalues = jni::Array<std::wstring>(a.getHandle()).toVector();
+
+    ASSERT(values.size() == 1000);
+    ASSERT(wvalues.size() == 1000);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        ASSERT(values[i] == std::to_string(i));
+        ASSERT(wvalues[i] == std::to_wstring(i));
+    }
+}
+
+TEST(Array_toVector_nullString)
+{
+    jni::Array<std::string> a(3);
+
+    a.setElement(1, "Testing");
+
+    std::vector<std::string> values = a.toVector();
+
+    ASSERT(values.size() == 3);
+    ASSERT(values[0].empty());
+    ASSERT(values[1] == "Testing");
+    ASSERT(values[2].empty());
+}
+
+TEST(Array_fromVector_basicType)
+{
+    std::vector<double> values = { 1.0, 2.5, -3.0 };
+    jni::Array<double> a(values);
+
+    ASSERT(a.getLength() == 3);
+    ASSERT(a.getElement(1) == 2.5);    // Warning: floating point comparison.
+    ASSERT(a.toVector() == values);
+}
+
+TEST(Array_fromVector_string)
+{
+    std::vector<std::string> values;
+
+    for (int i = 0; i < 1000; i++)
+        values.push_back("Item " + std::to_string(i));
+
+    jni::Array<std::string> a(values);
+
+    ASSERT(a.getLength() == 1000);
+    ASSERT(a.getElement(999) == "Item 999");
+    ASSERT(a.toVector() == values);
+}
+
+TEST(Array_region)
+{
+    jni::Array<jni::byte_t> a(10);
+    jni::byte_t input[] = { 1, 2, 3, 4 };
+    jni::byte_t output[4] = {};
+
+    a.setRegion(3, 4, input);
+    a.getRegion(2, 4, output);
+
+    ASSERT(output[0] == 0);
+    ASSERT(output[1] == 1);
+    ASSERT(output[3] == 3);
+    ASSERT(a.getElement(6) == 4);
+}
+
+TEST(Array_region_indexException)
+{
+    jni::Array<int> a(4);
+    int input[] = { 1, 2 };
+
+    try
+    {
+        a.setRegion(3, 2, input);
+    }
+    catch (jni::InvocationException&)
+    {
+        ASSERT(1);
+        return;
+    }
+
+    ASSERT(0);
+}
+
 /*
     Argument Type Tests
  */
@@ -572,6 +945,154 @@ TEST(Arg_ObjectPtr)
     ASSERT(i == 123);
 }
 
+TEST(Arg_string)
+{
+    int i1 = jni::Class("java/lang/Integer").call<int>("parseInt", std::string("123"));
+    int i2 = jni::Class("java/lang/Integer").call<int>("parseInt", std::wstring(L"123"));
+    int i3 = jni::Class("java/lang/Integer").call<int>("parseInt", "123");
+
+    ASSERT(i1 == 123);
+    ASSERT(i2 == 123);
+    ASSERT(i3 == 123);
+}
+
+/*
+    jni::CallBatch Tests
+ */
+
+TEST(CallBatch_execute)
+{
+    jni::Object builder = jni::Class("java/lang/StringBuilder").newInstance("abcdef");
+    jni::CallBatch batch;
+
+    batch.add(builder, "setLength", 4)
+         .add(builder, "setCharAt", 0, L'X')
+         .add(builder, "ensureCapacity", 64);
+
+    ASSERT(batch.size() == 3);
+
+    batch.execute();
+
+    ASSERT(builder.call<std::string>("toString") == "Xbcd");
+}
+
+TEST(CallBatch_reportsFailedCall)
+{
+    jni::Object builder = jni::Class("java/lang/StringBuilder").newInstance("abcdef");
+    jni::CallBatch batch;
+
+    batch.add(builder, "setLength", 2)
+         .add(builder, "setLength", -1)    // Throws an exception.
+         .add(builder, "setLength", 0);
+
+    try
+    {
+        batch.execute();
+    }
+    catch (jni::CallBatchException& e)
+    {
+        ASSERT(e.getIndex() == 1);
+        ASSERT(builder.call<std::string>("toString") == "ab");
+        return;
+    }
+
+    ASSERT(0);
+}
+
+/*
+    jni::FieldSet Tests
+ */
+
+struct PointData
+{
+    int x;
+    int y;
+};
+
+TEST(FieldSet_read)
+{
+    jni::FieldSet<PointData> fields("java/awt/Point");
+    fields.add("x", &PointData::x).add("y", &PointData::y);
+
+    jni::Object point = jni::Class("java/awt/Point").newInstance(3, 4);
+    PointData data = fields.read(point);
+
+    ASSERT(fields.size() == 2);
+    ASSERT(data.x == 3);
+    ASSERT(data.y == 4);
+}
+
+TEST(FieldSet_write)
+{
+    jni::FieldSet<PointData> fields("java/awt/Point");
+    fields.add("x", &PointData::x).add("y", &PointData::y);
+
+    jni::Object point = jni::Class("java/awt/Point").newInstance();
+    PointData data = { 7, 8 };
+    fields.write(point, data);
+
+    ASSERT(point.get<int>("x") == 7);
+    ASSERT(point.get<int>("y") == 8);
+}
+
+struct PointColumns
+{
+    std::vector<int> x;
+    std::vector<int> y;
+};
+
+TEST(FieldColumns_gatherScatter)
+{
+    jni::FieldColumns<PointColumns> columns("java/awt/Point");
+    columns.add("x", &PointColumns::x).add("y", &PointColumns::y);
+
+    jni::Class pointClass("java/awt/Point");
+    jni::Array<jni::Object> points(3, pointClass);
+
+    for (long i = 0; i < 3; ++i)
+        points.setElement(i, pointClass.newInstance(int(i), int(i * 10)));
+
+    PointColumns data;
+    columns.gather(points, data);
+
+    ASSERT(data.x == std::vector<int>({ 0, 1, 2 }));
+    ASSERT(data.y == std::vector<int>({ 0, 10, 20 }));
+
+    for (auto& y : data.y)
+        y += 5;
+    columns.scatter(points, data);
+
+    ASSERT(points.getElement(2).get<int>("y") == 25);
+}
+
+TEST(FieldColumns_scatter_shortColumn)
+{
+    jni::FieldColumns<PointColumns> columns("java/awt/Point");
+    columns.add("x", &PointColumns::x).add("y", &PointColumns::y);
+
+    jni::Class pointClass("java/awt/Point");
+    jni::Array<jni::Object> points(3, pointClass);
+
+    for (long i = 0; i < 3; ++i)
+        points.setElement(i, pointClass.newInstance(int(i), int(i * 10)));
+
+    PointColumns data;
+    data.x = { 7, 8, 9 };
+    data.y = { 70, 80 };
+
+    try
+    {
+        columns.scatter(points, data);
+        ASSERT(0);
+    }
+    catch (std::invalid_argument&)
+    {
+    }
+
+    // Nothing was written before the sizes were checked.
+    ASSERT(points.getElement(0).get<int>("x") == 0);
+}
+
 int main()
 {
     // jni::Vm Tests
@@ -585,6 +1106,7 @@ int main()
         RUN_TEST(Class_findByName_success);
         RUN_TEST(Class_findByName_failure);
         RUN_TEST(Class_getName);
+        RUN_TEST(Class_wellKnown);
         RUN_TEST(Class_getParent);
         RUN_TEST(Class_newInstance);
         RUN_TEST(Class_newInstance_withArgs);
@@ -600,6 +1122,12 @@ int main()
         // jni::Object Tests
         RUN_TEST(Object_defaultConstructor_isNull);
         RUN_TEST(Object_nullary_construct_from_signature);
+        RUN_TEST(Object_isNullHandle);
+        RUN_TEST(Object_makeShared);
+        RUN_TEST(Object_deferredRelease);
+        RUN_TEST(Object_getClass_shared);
+        RUN_TEST(Object_getClass_reusedAfterLastUser);
+        RUN_TEST(purgeClassTable_releasesIdleClasses);
         RUN_TEST(Object_copyConstructorIsSameObject);
         RUN_TEST(Object_moveConstructor);
         RUN_TEST(Object_copyAssignmentOperator);
@@ -610,6 +1138,19 @@ int main()
         RUN_TEST(Object_call_byNameWithArgs);
         RUN_TEST(Object_call_returningArray);
         RUN_TEST(Object_makeLocalReference);
+        RUN_TEST(LocalFrame_releasesLocalReferences);
+
+        // jni::Ref Tests
+        RUN_TEST(Ref_defaultConstructor_isNull);
+        RUN_TEST(Ref_fromObject);
+        RUN_TEST(Ref_fromObject_move);
+        RUN_TEST(Ref_copyConstructorIsSameObject);
+
+        // jni::WeakObject Tests
+        RUN_TEST(WeakObject_defaultConstructor_isExpired);
+        RUN_TEST(WeakObject_lock);
+        RUN_TEST(WeakObject_compare);
+        RUN_TEST(WeakObject_deferredRelease);
 
         // jni::Enum Tests
         RUN_TEST(Enum_get);
@@ -626,6 +1167,13 @@ int main()
         RUN_TEST(Array_setElement_basicType);
         RUN_TEST(Array_setElement_string);
         RUN_TEST(Array_setElement_indexException);
+        RUN_TEST(Array_toVector_basicType);
+        RUN_TEST(Array_toVector_string);
+        RUN_TEST(Array_toVector_nullString);
+        RUN_TEST(Array_fromVector_basicType);
+        RUN_TEST(Array_fromVector_string);
+        RUN_TEST(Array_region);
+        RUN_TEST(Array_region_indexException);
 
         // Argument Type Tests
         RUN_TEST(Arg_bool);
@@ -636,6 +1184,17 @@ int main()
         RUN_TEST(Arg_longLong);
         RUN_TEST(Arg_Object);
         RUN_TEST(Arg_ObjectPtr);
+        RUN_TEST(Arg_string);
+
+        // jni::CallBatch Tests
+        RUN_TEST(CallBatch_execute);
+        RUN_TEST(CallBatch_reportsFailedCall);
+
+        // jni::FieldSet Tests
+        RUN_TEST(FieldSet_read);
+        RUN_TEST(FieldSet_write);
+        RUN_TEST(FieldColumns_gatherScatter);
+        RUN_TEST(FieldColumns_scatter_shortColumn);
     }
 
     return 0;
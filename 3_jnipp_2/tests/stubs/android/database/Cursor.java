@@ -0,0 +1,19 @@
+// Copyright 2021, Collabora, Ltd.
+//
+// SPDX-License-Identifier: MIT
+
+package android.database;
+
+/**
+ * Host-JVM stand-in for the subset of android.database.Cursor that the
+ * wrappers use.
+ */
+public interface Cursor {
+    int getCount();
+    boolean moveToFirst();
+    boolean moveToNext();
+    int getColumnIndex(String columnName);
+    String getString(int columnIndex);
+    int getInt(int columnIndex);
+    void close();
+}
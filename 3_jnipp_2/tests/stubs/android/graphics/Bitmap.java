@@ -0,0 +1,161 @@
+// Copyright 2021, Collabora, Ltd.
+//
+// SPDX-License-Identifier: MIT
+
+package android.graphics;
+
+import android.util.DisplayMetrics;
+import java.io.OutputStream;
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.util.Arrays;
+
+/**
+ * Host-JVM stand-in for android.graphics.Bitmap: a byte array of tightly
+ * packed rows. Only createBitmap(int, int, Config) is implemented; the other
+ * factories exist so that the wrapper can resolve them.
+ */
+public final class Bitmap {
+    public enum Config {
+        ALPHA_8(1),
+        RGB_565(2),
+        ARGB_4444(2),
+        ARGB_8888(4);
+
+        final int bytesPerPixel;
+
+        Config(int bytesPerPixel) {
+            this.bytesPerPixel = bytesPerPixel;
+        }
+    }
+
+    public enum CompressFormat {
+        JPEG,
+        PNG,
+        WEBP
+    }
+
+    private final int width;
+    private final int height;
+    private final int rowBytes;
+    private final byte[] pixels;
+
+    private Bitmap(int width, int height, Config config) {
+        this.width = width;
+        this.height = height;
+        this.rowBytes = width * config.bytesPerPixel;
+        this.pixels = new byte[rowBytes * height];
+    }
+
+    public static Bitmap createBitmap(int width, int height, Config config) {
+        return new Bitmap(width, height, config);
+    }
+
+    public static Bitmap createBitmap(Bitmap src) {
+        throw new UnsupportedOperationException();
+    }
+
+    public static Bitmap createBitmap(Bitmap source, int x, int y, int width, int height) {
+        throw new UnsupportedOperationException();
+    }
+
+    public static Bitmap createBitmap(Bitmap source, int x, int y, int width, int height,
+                                      Matrix m, boolean filter) {
+        throw new UnsupportedOperationException();
+    }
+
+    public static Bitmap createBitmap(DisplayMetrics display, int width, int height,
+                                      Config config) {
+        throw new UnsupportedOperationException();
+    }
+
+    public static Bitmap createBitmap(int width, int height, Config config, boolean hasAlpha) {
+        throw new UnsupportedOperationException();
+    }
+
+    public static Bitmap createBitmap(int width, int height, Config config, boolean hasAlpha,
+                                      ColorSpace colorSpace) {
+        throw new UnsupportedOperationException();
+    }
+
+    public static Bitmap createBitmap(DisplayMetrics display, int width, int height,
+                                      Config config, boolean hasAlpha) {
+        throw new UnsupportedOperationException();
+    }
+
+    public static Bitmap createBitmap(DisplayMetrics display, int width, int height,
+                                      Config config, boolean hasAlpha, ColorSpace colorSpace) {
+        throw new UnsupportedOperationException();
+    }
+
+    public static Bitmap createBitmap(int[] colors, int offset, int stride, int width,
+                                      int height, Config config) {
+        throw new UnsupportedOperationException();
+    }
+
+    public static Bitmap createBitmap(DisplayMetrics display, int[] colors, int offset,
+                                      int stride, int width, int height, Config config) {
+        throw new UnsupportedOperationException();
+    }
+
+    public static Bitmap createBitmap(int[] colors, int width, int height, Config config) {
+        throw new UnsupportedOperationException();
+    }
+
+    public static Bitmap createBitmap(DisplayMetrics display, int[] colors, int width,
+                                      int height, Config config) {
+        throw new UnsupportedOperationException();
+    }
+
+    public static Bitmap createBitmap(Picture source) {
+        throw new UnsupportedOperationException();
+    }
+
+    public static Bitmap createBitmap(Picture source, int width, int height, Config config) {
+        throw new UnsupportedOperationException();
+    }
+
+    public void copyPixelsToBuffer(Buffer dst) {
+        ByteBuffer bytes = (ByteBuffer) dst;
+        if (bytes.remaining() < pixels.length) {
+            throw new RuntimeException("Buffer not large enough for pixels");
+        }
+        bytes.put(pixels);
+    }
+
+    public void copyPixelsFromBuffer(Buffer src) {
+        ByteBuffer bytes = (ByteBuffer) src;
+        if (bytes.remaining() < pixels.length) {
+            throw new RuntimeException("Buffer not large enough for pixels");
+        }
+        bytes.get(pixels);
+    }
+
+    public boolean compress(CompressFormat format, int quality, OutputStream stream) {
+        return false;
+    }
+
+    public int getWidth() {
+        return width;
+    }
+
+    public int getHeight() {
+        return height;
+    }
+
+    public int getRowBytes() {
+        return rowBytes;
+    }
+
+    public int getByteCount() {
+        return pixels.length;
+    }
+
+    public void eraseColor(int c) {
+        Arrays.fill(pixels, (byte) c);
+    }
+
+    public void eraseColor(long color) {
+        eraseColor((int) color);
+    }
+}
@@ -0,0 +1,11 @@
+// Copyright 2021, Collabora, Ltd.
+//
+// SPDX-License-Identifier: MIT
+
+package android.graphics;
+
+/**
+ * Host-JVM stand-in for android.graphics.Picture, only named in Bitmap methods.
+ */
+public class Picture {
+}
@@ -0,0 +1,21 @@
+// Copyright 2021, Collabora, Ltd.
+//
+// SPDX-License-Identifier: MIT
+
+package android.graphics;
+
+/**
+ * Host-JVM stand-in for android.graphics.Point.
+ */
+public class Point {
+    public int x;
+    public int y;
+
+    public Point() {
+    }
+
+    public Point(int x, int y) {
+        this.x = x;
+        this.y = y;
+    }
+}
@@ -0,0 +1,54 @@
+// Copyright 2021, Collabora, Ltd.
+//
+// SPDX-License-Identifier: MIT
+
+package android.os;
+
+import java.util.HashMap;
+import java.util.Set;
+
+/**
+ * Host-JVM stand-in for the subset of android.os.BaseBundle that the
+ * wrappers use. Like the real one, it accepts a null key.
+ */
+public class BaseBundle {
+    protected final HashMap<String, Object> map = new HashMap<String, Object>();
+
+    public boolean containsKey(String key) {
+        return map.containsKey(key);
+    }
+
+    public Object get(String key) {
+        return map.get(key);
+    }
+
+    public Set<String> keySet() {
+        return map.keySet();
+    }
+
+    public String getString(String key) {
+        Object value = map.get(key);
+        return value instanceof String ? (String) value : null;
+    }
+
+    public String getString(String key, String defaultValue) {
+        String value = getString(key);
+        return value == null ? defaultValue : value;
+    }
+
+    public void putString(String key, String value) {
+        map.put(key, value);
+    }
+
+    public void putInt(String key, int value) {
+        map.put(key, value);
+    }
+
+    public void putBoolean(String key, boolean value) {
+        map.put(key, value);
+    }
+
+    public void putLong(String key, long value) {
+        map.put(key, value);
+    }
+}
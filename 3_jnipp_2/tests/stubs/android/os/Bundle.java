@@ -0,0 +1,14 @@
+// Copyright 2021, Collabora, Ltd.
+//
+// SPDX-License-Identifier: MIT
+
+package android.os;
+
+/**
+ * Host-JVM stand-in for android.os.Bundle.
+ */
+public final class Bundle extends BaseBundle {
+    public void putFloat(String key, float value) {
+        map.put(key, value);
+    }
+}
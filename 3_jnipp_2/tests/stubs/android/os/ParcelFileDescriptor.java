@@ -0,0 +1,44 @@
+// Copyright 2021, Collabora, Ltd.
+//
+// SPDX-License-Identifier: MIT
+
+package android.os;
+
+/**
+ * Host-JVM stand-in for the subset of android.os.ParcelFileDescriptor that
+ * the wrappers use. It tracks ownership like the real one, but close() does
+ * not close the native descriptor: the tests do that themselves.
+ */
+public class ParcelFileDescriptor {
+    private int fd;
+    private boolean closed;
+
+    private ParcelFileDescriptor(int fd) {
+        this.fd = fd;
+    }
+
+    public static ParcelFileDescriptor adoptFd(int fd) {
+        return new ParcelFileDescriptor(fd);
+    }
+
+    public int getFd() {
+        if (closed) {
+            throw new IllegalStateException("Already closed");
+        }
+        return fd;
+    }
+
+    public int detachFd() {
+        int result = getFd();
+        closed = true;
+        fd = -1;
+        return result;
+    }
+
+    public void close() {
+        closed = true;
+    }
+
+    public void checkError() {
+    }
+}
@@ -0,0 +1,18 @@
+// Copyright 2021, Collabora, Ltd.
+//
+// SPDX-License-Identifier: MIT
+
+package android.util;
+
+/**
+ * Host-JVM stand-in for the public fields of android.util.DisplayMetrics.
+ */
+public class DisplayMetrics {
+    public int widthPixels;
+    public int heightPixels;
+    public float density;
+    public int densityDpi;
+    public float scaledDensity;
+    public float xdpi;
+    public float ydpi;
+}
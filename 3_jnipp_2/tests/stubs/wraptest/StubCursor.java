@@ -0,0 +1,79 @@
+// Copyright 2021, Collabora, Ltd.
+//
+// SPDX-License-Identifier: MIT
+
+package wraptest;
+
+import android.database.Cursor;
+
+/**
+ * Cursor over generated rows: column "_id" holds the row number, and column
+ * "name" holds "row" followed by the row number, or null for every fifth row.
+ * Optionally, reading "_id" throws from a given row on.
+ */
+public class StubCursor implements Cursor {
+    private final int count;
+    private final int failAt;
+    private int position = -1;
+    public boolean closed;
+
+    public StubCursor(int count) {
+        this(count, -1);
+    }
+
+    public StubCursor(int count, int failAt) {
+        this.count = count;
+        this.failAt = failAt;
+    }
+
+    public int getCount() {
+        return count;
+    }
+
+    public int getPosition() {
+        return position;
+    }
+
+    public boolean moveToFirst() {
+        position = 0;
+        return count > 0;
+    }
+
+    public boolean moveToNext() {
+        if (position < count) {
+            ++position;
+        }
+        return position < count;
+    }
+
+    public int getColumnIndex(String columnName) {
+        if (columnName.equals("_id")) {
+            return 0;
+        }
+        if (columnName.equals("name")) {
+            return 1;
+        }
+        return -1;
+    }
+
+    public String getString(int columnIndex) {
+        if (columnIndex == 1 && position % 5 == 4) {
+            return null;
+        }
+        return columnIndex == 0 ? Integer.toString(position) : "row" + position;
+    }
+
+    public int getInt(int columnIndex) {
+        if (columnIndex != 0) {
+            throw new IllegalArgumentException("not an int column");
+        }
+        if (failAt >= 0 && position >= failAt) {
+            throw new IllegalStateException("failing at row " + position);
+        }
+        return position;
+    }
+
+    public void close() {
+        closed = true;
+    }
+}
@@ -0,0 +1,1285 @@
+// Project Dependencies
+#include <jnipp.h>
+
+#include "CursorReader.h"
+#include "CursorStream.h"
+#include "ListRange.h"
+#include "MappedFile.h"
+#include "NativeFdHandle.h"
+#include "OutputStreamSink.h"
+#include "PixelBufferPool.h"
+#include "Preload.h"
+#include "Snapshot.h"
+#include "StreamReader.h"
+#include "TextBatch.h"
+#include "android.database.h"
+#include "android.graphics.h"
+#include "android.os.h"
+#include "android.util.h"
+
+// Standard Dependencies
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+// Local Dependencies
+#include "testing.h"
+
+/*
+    These tests run the android-jni-wrappers helpers on a host JVM, against
+    the stand-in Android classes in stubs/.
+ */
+
+static jni::Object newStub(const char* name, int arg)
+{
+    return jni::Class(name).newInstance(arg);
+}
+
+/*
+    wrap::impl::MethodId Tests
+ */
+
+TEST(MethodId_signatureMatches)
+{
+    using wrap::impl::signatureMatches;
+
+    ASSERT((signatureMatches<int32_t>("()I")));
+    ASSERT((!signatureMatches<int32_t>("()J")));
+    ASSERT((signatureMatches<void, jni::Array<uint16_t>>("([C)V")));
+    ASSERT((!signatureMatches<void, jni::Array<uint16_t>>("([S)V")));
+    ASSERT((signatureMatches<jni::Object, std::string, int32_t>("(Ljava/lang/String;I)Ljava/util/List;")));
+    ASSERT((!signatureMatches<void, std::string>("(Ljava/lang/Object;)V")));
+    ASSERT((!signatureMatches<void>("(I)V")));
+    ASSERT((!signatureMatches<void, int32_t>("()V")));
+}
+
+TEST(MethodId_call)
+{
+    jni::Class bundleClass("android/os/Bundle");
+    wrap::impl::MethodId<void(std::string, int32_t)> putInt(bundleClass, "putInt", "(Ljava/lang/String;I)V");
+    wrap::impl::MethodId<bool(std::string)> containsKey(bundleClass, "containsKey", "(Ljava/lang/String;)Z");
+    jni::Object bundle = bundleClass.newInstance();
+
+    putInt.call(bundle, "int", 42);
+    ASSERT(containsKey.call(bundle, "int"));
+    ASSERT(!containsKey.call(bundle, "other"));
+}
+
+TEST(MethodId_rejectsMismatch)
+{
+    jni::Class bundleClass("android/os/Bundle");
+
+    try
+    {
+        wrap::impl::MethodId<int32_t(std::string)> getInt(bundleClass, "getString", "(Ljava/lang/String;)J");
+    }
+    catch (jni::NameResolutionException&)
+    {
+        ASSERT(1);
+        return;
+    }
+
+    ASSERT(0);
+}
+
+TEST(StaticMethodId_rejectsMismatch)
+{
+    jni::Class pfdClass("android/os/ParcelFileDescriptor");
+
+    try
+    {
+        wrap::impl::StaticMethodId<jni::Object(int64_t)> adoptFd(pfdClass, "adoptFd", "(I)Landroid/os/ParcelFileDescriptor;");
+    }
+    catch (jni::NameResolutionException&)
+    {
+        ASSERT(1);
+        return;
+    }
+
+    ASSERT(0);
+}
+
+/*
+    wrap::CursorReader Tests
+ */
+
+TEST(CursorReader_fetchBatches)
+{
+    using Column = wrap::CursorReader::Column;
+    using Type = wrap::CursorReader::ColumnType;
+
+    wrap::android::database::Cursor cursor(newStub("wraptest/StubCursor", 10));
+    wrap::CursorReader reader(cursor, { Column{ "name", Type::String }, Column{ "_id", Type::Int } }, 4);
+
+    ASSERT(reader.fetch() == 4);
+    ASSERT(reader.ints(1) == std::vector<int32_t>({ 0, 1, 2, 3 }));
+    ASSERT(reader.getString(0, 0) == "row0");
+    ASSERT(reader.getString(0, 3) == "row3");
+
+    ASSERT(reader.fetch() == 4);
+    ASSERT(reader.getInt(1, 0) == 4);
+    ASSERT(reader.getString(0, 0).empty());    // Null strings read as empty.
+    ASSERT(reader.getString(0, 1) == "row5");
+
+    ASSERT(reader.fetch() == 2);
+    ASSERT(reader.getInt(1, 1) == 9);
+    ASSERT(reader.fetch() == 0);
+    ASSERT(reader.rows() == 0);
+}
+
+TEST(CursorReader_unknownColumn)
+{
+    using Column = wrap::CursorReader::Column;
+    using Type = wrap::CursorReader::ColumnType;
+
+    wrap::android::database::Cursor cursor(newStub("wraptest/StubCursor", 1));
+
+    try
+    {
+        wrap::CursorReader reader(cursor, { Column{ "missing", Type::Int } });
+    }
+    catch (jni::NameResolutionException&)
+    {
+        ASSERT(1);
+        return;
+    }
+
+    ASSERT(0);
+}
+
+TEST(CursorReader_javaException)
+{
+    using Column = wrap::CursorReader::Column;
+    using Type = wrap::CursorReader::ColumnType;
+
+    // Reading the string column as an int makes the stub throw.
+    wrap::android::database::Cursor cursor(newStub("wraptest/StubCursor", 3));
+    wrap::CursorReader reader(cursor, { Column{ "name", Type::Int } });
+
+    try
+    {
+        reader.fetch();
+    }
+    catch (jni::InvocationException&)
+    {
+        ASSERT(1);
+        return;
+    }
+
+    ASSERT(0);
+}
+
+/*
+    wrap::CursorStream Tests
+ */
+
+TEST(CursorStream_batchOrder)
+{
+    using Column = wrap::CursorReader::Column;
+    using Type = wrap::CursorReader::ColumnType;
+
+    wrap::android::database::Cursor cursor(newStub("wraptest/StubCursor", 10));
+    wrap::CursorStream stream(cursor, { Column{ "_id", Type::Int }, Column{ "name", Type::String } }, 4);
+    std::vector<std::size_t> sizes;
+    std::vector<int32_t> ids;
+
+    for (const wrap::CursorReader& batch : stream)
+    {
+        sizes.push_back(batch.rows());
+        ids.insert(ids.end(), batch.ints(0).begin(), batch.ints(0).end());
+        // Every fifth name is null, but never the second of a batch here.
+        ASSERT(batch.getString(1, 1) == "row" + std::to_string(ids[ids.size() - batch.rows() + 1]));
+    }
+
+    ASSERT(sizes == std::vector<std::size_t>({ 4, 4, 2 }));
+    ASSERT(ids == std::vector<int32_t>({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
+    ASSERT(stream.next() == nullptr);
+}
+
+TEST(CursorStream_slowConsumer)
+{
+    using Column = wrap::CursorReader::Column;
+    using Type = wrap::CursorReader::ColumnType;
+
+    jni::Object stub = newStub("wraptest/StubCursor", 100);
+    wrap::CursorStream stream(wrap::android::database::Cursor(stub), { Column{ "_id", Type::Int } }, 4);
+
+    ASSERT(stream.next() != nullptr);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // The fetch thread stops one batch ahead of the one being processed.
+    ASSERT(stub.call<int>("getPosition") <= 7);
+
+    int32_t expected = 4;
+    while (const wrap::CursorReader* batch = stream.next())
+    {
+        for (int32_t id : batch->ints(0))
+            ASSERT(id == expected++);
+    }
+
+    ASSERT(expected == 100);
+}
+
+TEST(CursorStream_cancel)
+{
+    using Column = wrap::CursorReader::Column;
+    using Type = wrap::CursorReader::ColumnType;
+
+    jni::Object stub = newStub("wraptest/StubCursor", 100);
+    wrap::CursorStream stream(wrap::android::database::Cursor(stub), { Column{ "_id", Type::Int } }, 4);
+
+    ASSERT(stream.next() != nullptr);
+    stream.cancel();
+
+    ASSERT(stream.next() == nullptr);
+    ASSERT(stub.call<int>("getPosition") < 99);
+    ASSERT(!stub.get<bool>("closed"));
+}
+
+TEST(CursorStream_closeWhileBlocked)
+{
+    using Column = wrap::CursorReader::Column;
+    using Type = wrap::CursorReader::ColumnType;
+
+    jni::Object stub = newStub("wraptest/StubCursor", 100);
+    wrap::CursorStream stream(wrap::android::database::Cursor(stub), { Column{ "_id", Type::Int } }, 4);
+
+    // Give the fetch thread time to fill the other batch and wait.
+    ASSERT(stream.next() != nullptr);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    stream.close();
+
+    ASSERT(stub.get<bool>("closed"));
+    ASSERT(stream.next() == nullptr);
+}
+
+TEST(CursorStream_javaException)
+{
+    using Column = wrap::CursorReader::Column;
+    using Type = wrap::CursorReader::ColumnType;
+
+    // Reading "_id" throws from row 6: the first batch still arrives.
+    jni::Object stub = jni::Class("wraptest/StubCursor").newInstance(100, 6);
+    wrap::CursorStream stream(wrap::android::database::Cursor(stub), { Column{ "_id", Type::Int } }, 4);
+
+    const wrap::CursorReader* batch = stream.next();
+    ASSERT(batch != nullptr);
+    ASSERT(batch->rows() == 4);
+
+    try
+    {
+        stream.next();
+    }
+    catch (jni::InvocationException&)
+    {
+        ASSERT(stream.next() == nullptr);
+        return;
+    }
+
+    ASSERT(0);
+}
+
+/*
+    wrap::ListRange Tests
+ */
+
+static wrap::java::util::List newList(int count)
+{
+    jni::Object list = jni::Class("java/util/ArrayList").newInstance();
+
+    for (int i = 0; i < count; ++i)
+        list.call<bool>("add", jni::Class("java/lang/String").newInstance(std::to_string(i)));
+
+    return wrap::java::util::List(list);
+}
+
+TEST(ListRange_temporaryList)
+{
+    std::string joined;
+
+    // The range must keep the temporary List alive for the whole loop.
+    for (auto& element : wrap::ListRange<>(newList(3)))
+        joined += element.call<std::string>("toString");
+
+    ASSERT(joined == "012");
+}
+
+/*
+    wrap::snapshot Tests
+ */
+
+TEST(Snapshot_point)
+{
+    wrap::android::graphics::Point point(jni::Class("android/graphics/Point").newInstance(3, -4));
+
+    wrap::PointValue value = wrap::snapshot(point);
+
+    ASSERT(value.x == 3);
+    ASSERT(value.y == -4);
+    ASSERT(point.getX() == 3);
+}
+
+TEST(Snapshot_displayMetrics)
+{
+    jni::Object metrics = jni::Class("android/util/DisplayMetrics").newInstance();
+    metrics.set("widthPixels", 1080);
+    metrics.set("heightPixels", 1920);
+    metrics.set("density", 2.5f);
+    metrics.set("densityDpi", 400);
+    metrics.set("xdpi", 401.5f);
+    metrics.set("ydpi", 402.5f);
+
+    wrap::DisplayMetricsValue value = wrap::snapshot(wrap::android::util::DisplayMetrics(metrics));
+
+    ASSERT(value.widthPixels == 1080);
+    ASSERT(value.heightPixels == 1920);
+    ASSERT(value.density == 2.5f);
+    ASSERT(value.densityDpi == 400);
+    ASSERT(value.xdpi == 401.5f);
+    ASSERT(value.ydpi == 402.5f);
+}
+
+TEST(Snapshot_bundle)
+{
+    jni::Object bundle = jni::Class("android/os/Bundle").newInstance();
+    bundle.call<void>("putString", "name", "value");
+    bundle.call<void>("putString", "", "empty key");
+    bundle.call<void>("putInt", "int", 42);
+    bundle.call<void>("putBoolean", "bool", true);
+    bundle.call<void>("putLong", "long", 1LL << 40);
+    bundle.call<void>("putFloat", "float", 1.5f);
+
+    // A null key must not clobber the empty one.
+    jni::method_t putString = jni::Class("android/os/Bundle").getMethod("putString", "(Ljava/lang/String;Ljava/lang/String;)V");
+    bundle.call<void>(putString, "nothing", jni::Object());
+    bundle.call<void>(putString, jni::Object(), "null key");
+
+    wrap::BundleSnapshot values = wrap::snapshot(wrap::android::os::Bundle(bundle));
+
+    ASSERT(values.size() == 7);
+    ASSERT(std::get<std::string>(values.at("name")) == "value");
+    ASSERT(std::get<std::string>(values.at("")) == "empty key");
+    ASSERT(std::holds_alternative<std::monostate>(values.at("nothing")));
+    ASSERT(std::get<int32_t>(values.at("int")) == 42);
+    ASSERT(std::get<bool>(values.at("bool")));
+    ASSERT(std::get<int64_t>(values.at("long")) == 1LL << 40);
+    ASSERT(std::holds_alternative<std::monostate>(values.at("float")));
+}
+
+/*
+    wrap::NativeFdHandle Tests
+ */
+
+// Creates an unlinked temporary file holding `contents`.
+static int tempFile(const std::string& contents)
+{
+    char path[] = "/tmp/wrap_testXXXXXX";
+    int fd = ::mkstemp(path);
+
+    ::unlink(path);
+    if (!contents.empty() && ::write(fd, contents.data(), contents.size()) != ssize_t(contents.size()))
+        throw std::runtime_error("could not fill temporary file");
+
+    return fd;
+}
+
+// Creates an empty temporary file, returning its path.
+static std::string tempPath()
+{
+    char path[] = "/tmp/wrap_testXXXXXX";
+
+    ::close(::mkstemp(path));
+
+    return path;
+}
+
+static std::string readFile(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static void writeFile(const std::string& path, const std::string& contents)
+{
+    std::ofstream file(path, std::ios::binary);
+
+    file.write(contents.data(), std::streamsize(contents.size()));
+}
+
+static bool isOpen(int fd)
+{
+    return ::fcntl(fd, F_GETFD) != -1;
+}
+
+static std::string pattern(std::size_t size)
+{
+    std::string result(size, '\0');
+
+    for (std::size_t i = 0; i < size; ++i)
+        result[i] = char(i * 7 % 251);
+
+    return result;
+}
+
+static void onSignal(int)
+{
+}
+
+TEST(NativeFdHandle_detach)
+{
+    int fd = tempFile("hello");
+    auto pfd = wrap::android::os::ParcelFileDescriptor::adoptFd(fd);
+    wrap::NativeFdHandle handle = wrap::NativeFdHandle::detach(pfd);
+    char buffer[5];
+
+    ASSERT(handle.get() == fd);
+    ASSERT(handle.pread(buffer, sizeof(buffer), 0) == 5);
+    ASSERT(std::string(buffer, 5) == "hello");
+
+    try
+    {
+        pfd.getFd();
+        ASSERT(0);
+    }
+    catch (jni::InvocationException&)
+    {
+    }
+
+    handle.close();
+    ASSERT(!handle.valid());
+    ASSERT(!isOpen(fd) && errno == EBADF);
+}
+
+TEST(NativeFdHandle_dup)
+{
+    int fd = tempFile("hello");
+    auto pfd = wrap::android::os::ParcelFileDescriptor::adoptFd(fd);
+
+    {
+        wrap::NativeFdHandle handle = wrap::NativeFdHandle::dup(pfd);
+
+        ASSERT(handle.valid());
+        ASSERT(handle.get() != fd);
+        ASSERT(handle.fileSize() == 5);
+    }
+
+    // Closing the copy leaves the original with its owner.
+    ASSERT(isOpen(fd));
+    ASSERT(pfd.getFd() == fd);
+    ::close(fd);
+}
+
+TEST(NativeFdHandle_toParcelFileDescriptor)
+{
+    int fd = tempFile("");
+    wrap::NativeFdHandle handle(fd);
+    auto pfd = handle.toParcelFileDescriptor();
+
+    ASSERT(!handle.valid());
+    ASSERT(pfd.getFd() == fd);
+    ASSERT(isOpen(fd));
+    ::close(fd);
+}
+
+TEST(NativeFdHandle_partialWritev)
+{
+    int fds[2];
+    ASSERT(::pipe(fds) == 0);
+
+    // Much more than the pipe holds, so the writer blocks and a signal
+    // interrupts it part way through.
+    std::string data = pattern(3 * 100000);
+    iovec iov[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        iov[i].iov_base = &data[i * 100000];
+        iov[i].iov_len = 100000;
+    }
+
+    struct sigaction action = {};
+    struct sigaction previous;
+    action.sa_handler = onSignal;
+    sigemptyset(&action.sa_mask);
+    ::sigaction(SIGUSR1, &action, &previous);
+
+    wrap::NativeFdHandle handle(fds[1]);
+    std::size_t written = 0;
+    std::thread writer([&] { written = handle.writev(iov, 3); });
+
+    ::usleep(50000);
+    ::pthread_kill(writer.native_handle(), SIGUSR1);
+    ::usleep(50000);
+
+    std::string received;
+    char buffer[4096];
+    while (received.size() < data.size())
+    {
+        ssize_t count = ::read(fds[0], buffer, sizeof(buffer));
+        if (count <= 0)
+            break;
+        received.append(buffer, std::size_t(count));
+    }
+
+    writer.join();
+    ::sigaction(SIGUSR1, &previous, nullptr);
+    ::close(fds[0]);
+
+    ASSERT(written == data.size());
+    ASSERT(received == data);
+}
+
+TEST(NativeFdHandle_mapUnalignedOffset)
+{
+    long pageSize = ::sysconf(_SC_PAGESIZE);
+    std::string data = pattern(std::size_t(3 * pageSize));
+    wrap::NativeFdHandle handle(tempFile(data));
+
+    wrap::MappedView view = handle.map(pageSize + 3, 100);
+    ASSERT(view.size() == 100);
+    ASSERT(std::string(reinterpret_cast<const char*>(view.data()), 100) == data.substr(std::size_t(pageSize) + 3, 100));
+
+    // Up to the end of the file.
+    view = handle.map(5);
+    ASSERT(view.size() == data.size() - 5);
+    ASSERT(view.data()[0] == uint8_t(data[5]));
+}
+
+TEST(NativeFdHandle_mapEmptyFile)
+{
+    wrap::NativeFdHandle handle(tempFile(""));
+
+    wrap::MappedView view = handle.map();
+    ASSERT(view.empty());
+}
+
+TEST(NativeFdHandle_mapNegativeOffset)
+{
+    wrap::NativeFdHandle handle(tempFile("hello"));
+
+    try
+    {
+        handle.map(-1, 1);
+    }
+    catch (std::invalid_argument&)
+    {
+        ASSERT(1);
+        return;
+    }
+
+    ASSERT(0);
+}
+
+/*
+    wrap::MappedFile Tests
+ */
+
+static jni::Class byteBufferClass()
+{
+    return jni::Class("java/nio/ByteBuffer");
+}
+
+TEST(MappedFile_nativeReadWrite)
+{
+    std::string path = tempPath();
+    wrap::java::io::File file(jni::Class("java/io/File").newInstance(path));
+
+    {
+        wrap::MappedFile mapped = wrap::MappedFile::map(file, wrap::MappedFile::Access::ReadWrite, 4096);
+
+        ASSERT(mapped.writable());
+        ASSERT(mapped.size() == 4096);
+
+        // Both sides see the same pages.
+        jni::method_t put = byteBufferClass().getMethod("put", "(IB)Ljava/nio/ByteBuffer;");
+        jni::method_t get = byteBufferClass().getMethod("get", "(I)B");
+        const jni::Object& buffer = mapped.byteBuffer();
+
+        ASSERT(!buffer.call<bool>("isReadOnly"));
+        buffer.call<jni::Object>(put, 10, jni::byte_t(42));
+        ASSERT(mapped.data()[10] == 42);
+
+        mapped.data()[20] = 7;
+        ASSERT(buffer.call<jni::byte_t>(get, 20) == 7);
+
+        mapped.sync();
+    }
+
+    std::string contents = readFile(path);
+    ASSERT(contents.size() == 4096);
+    ASSERT(contents[10] == 42 && contents[20] == 7);
+    ::unlink(path.c_str());
+}
+
+TEST(MappedFile_readOnly)
+{
+    std::string path = tempPath();
+    std::string data = pattern(10000);
+    writeFile(path, data);
+    wrap::java::io::File file(jni::Class("java/io/File").newInstance(path));
+
+    wrap::MappedFile mapped = wrap::MappedFile::map(file);
+
+    ASSERT(!mapped.writable());
+    ASSERT(std::string(reinterpret_cast<const char*>(mapped.data()), mapped.size()) == data);
+    ASSERT(mapped.byteBuffer().call<bool>("isReadOnly"));
+    ASSERT(mapped.byteBuffer().call<int>("capacity") == 10000);
+    ::unlink(path.c_str());
+}
+
+TEST(MappedFile_fromFileChannel)
+{
+    std::string path = tempPath();
+    jni::Object file = jni::Class("java/io/RandomAccessFile").newInstance(path, "rw");
+    jni::Object channel = file.call<jni::Object>(jni::Class("java/io/RandomAccessFile").getMethod("getChannel", "()Ljava/nio/channels/FileChannel;"));
+    jni::Class mapMode("java/nio/channels/FileChannel$MapMode");
+    jni::Object readWrite = mapMode.get<jni::Object>(mapMode.getStaticField("READ_WRITE", "Ljava/nio/channels/FileChannel$MapMode;"));
+    jni::method_t map = jni::Class("java/nio/channels/FileChannel").getMethod("map", "(Ljava/nio/channels/FileChannel$MapMode;JJ)Ljava/nio/MappedByteBuffer;");
+
+    {
+        wrap::MappedFile mapped = wrap::MappedFile::fromByteBuffer(channel.call<jni::Object>(map, readWrite, 0LL, 4096LL));
+
+        ASSERT(mapped.writable());
+        ASSERT(mapped.size() == 4096);
+
+        mapped.data()[5] = 9;
+        mapped.sync();
+    }
+
+    channel.call<void>("close");
+    file.call<void>("close");
+
+    std::string contents = readFile(path);
+    ASSERT(contents.size() == 4096);
+    ASSERT(contents[5] == 9);
+    ::unlink(path.c_str());
+}
+
+TEST(MappedFile_fromHeapBuffer)
+{
+    jni::Class byteBuffer = byteBufferClass();
+    jni::Object heap = byteBuffer.call<jni::Object>(byteBuffer.getStaticMethod("allocate", "(I)Ljava/nio/ByteBuffer;"), 16);
+
+    try
+    {
+        wrap::MappedFile::fromByteBuffer(heap);
+    }
+    catch (std::invalid_argument&)
+    {
+        ASSERT(1);
+        return;
+    }
+
+    ASSERT(0);
+}
+
+/*
+    wrap::OutputStreamSink Tests
+ */
+
+static wrap::java::io::OutputStream newFileOutputStream(const std::string& path)
+{
+    return wrap::java::io::OutputStream(jni::Class("java/io/FileOutputStream").newInstance(path));
+}
+
+TEST(OutputStreamSink_chunkSizes)
+{
+    std::string path = tempPath();
+    std::string data = pattern(5 + 16 + 40 + 5 + 16);
+
+    {
+        wrap::OutputStreamSink sink(newFileOutputStream(path), 16);
+        const char* next = data.data();
+
+        // Smaller than, equal to and larger than a chunk, both with and
+        // without bytes already buffered.
+        for (std::size_t size : { 5, 16, 40, 5, 16 })
+        {
+            sink.write(next, size);
+            next += size;
+        }
+
+        sink.flush();
+        ASSERT(readFile(path) == data);
+
+        sink.write("tail", 4);
+        sink.close();
+    }
+
+    ASSERT(readFile(path) == data + "tail");
+    ::unlink(path.c_str());
+}
+
+TEST(OutputStreamSink_destructorWrites)
+{
+    std::string path = tempPath();
+    wrap::java::io::OutputStream stream = newFileOutputStream(path);
+
+    {
+        wrap::OutputStreamSink sink(stream, 16);
+        sink.write("buffered", 8);
+    }
+
+    stream.close();
+    ASSERT(readFile(path) == "buffered");
+    ::unlink(path.c_str());
+}
+
+/*
+    wrap::StreamReader Tests
+ */
+
+static wrap::java::io::InputStream newFileInputStream(const std::string& path)
+{
+    return wrap::java::io::InputStream(jni::Class("java/io/FileInputStream").newInstance(path));
+}
+
+TEST(StreamReader_readFully)
+{
+    std::string path = tempPath();
+    std::string data = pattern((3 << 20) + 123);
+    writeFile(path, data);
+
+    wrap::StreamReader reader(newFileInputStream(path), 64 * 1024);
+    std::string result(data.size(), '\0');
+
+    // More than a chunk at a time, ending exactly at the end of the file.
+    ASSERT(reader.readFully(&result[0], 100000));
+    ASSERT(reader.readFully(&result[100000], data.size() - 100000));
+    ASSERT(result == data);
+
+    char more;
+    ASSERT(!reader.readFully(&more, 1));
+    reader.close();
+    ::unlink(path.c_str());
+}
+
+TEST(StreamReader_shortStream)
+{
+    std::string path = tempPath();
+    writeFile(path, "hello");
+
+    wrap::StreamReader reader(newFileInputStream(path), 16);
+    char buffer[10];
+
+    ASSERT(!reader.readFully(buffer, sizeof(buffer)));
+    ASSERT(reader.read(buffer, sizeof(buffer)) == 0);
+    reader.close();
+    ::unlink(path.c_str());
+}
+
+TEST(StreamReader_skipAndAvailable)
+{
+    std::string path = tempPath();
+    std::string data = pattern(1 << 20);
+    writeFile(path, data);
+
+    wrap::StreamReader reader(newFileInputStream(path), 4096);
+    char buffer[16];
+
+    ASSERT(reader.available() == int32_t(data.size()));
+    ASSERT(reader.skip(1000) == 1000);
+    ASSERT(reader.available() == int32_t(data.size() - 1000));
+    ASSERT(reader.readFully(buffer, sizeof(buffer)));
+    ASSERT(std::string(buffer, sizeof(buffer)) == data.substr(1000, sizeof(buffer)));
+
+    wrap::StreamReader::Chunk chunk = reader.readChunk();
+    ASSERT(chunk.size > 0 && chunk.size <= 4096);
+    ASSERT(std::string(reinterpret_cast<const char*>(chunk.data), chunk.size) == data.substr(1016, chunk.size));
+    reader.close();
+    ::unlink(path.c_str());
+}
+
+TEST(StreamReader_readCritical)
+{
+    std::string path = tempPath();
+    std::string data = pattern((3 << 20) + 123);
+    writeFile(path, data);
+
+    wrap::StreamReader copying(newFileInputStream(path), 64 * 1024);
+    wrap::StreamReader critical(newFileInputStream(path), 64 * 1024);
+    std::string copied;
+    std::string visited;
+    char buffer[64 * 1024];
+
+    while (std::size_t count = copying.read(buffer, sizeof(buffer)))
+        copied.append(buffer, count);
+
+    auto append = [&](const jni::byte_t* bytes, std::size_t size) {
+        visited.append(reinterpret_cast<const char*>(bytes), size);
+    };
+    while (critical.readCritical(append) != 0)
+        ;
+
+    ASSERT(copied == data);
+    ASSERT(visited == data);
+    copying.close();
+    critical.close();
+    ::unlink(path.c_str());
+}
+
+/*
+    wrap::PixelBufferPool Tests
+ */
+
+static jni::Object bitmapConfig(const char* name)
+{
+    jni::Class config("android/graphics/Bitmap$Config");
+
+    return config.get<jni::Object>(config.getStaticField(name, "Landroid/graphics/Bitmap$Config;"));
+}
+
+TEST(PixelBufferPool_roundTrip)
+{
+    jni::Object argb = bitmapConfig("ARGB_8888");
+    auto bitmap = wrap::android::graphics::Bitmap::createBitmap(3, 2, argb);
+    wrap::PixelBufferPool pool;
+
+    // The second pass reuses the buffer, so it must have been rewound.
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        std::string pixels = pattern(24);
+        pixels[0] = char(pass);
+        std::string result(24, '\0');
+
+        pool.upload(bitmap, pixels.data());
+        pool.download(bitmap, &result[0]);
+        ASSERT(result == pixels);
+    }
+}
+
+TEST(PixelBufferPool_leaseReuse)
+{
+    wrap::PixelBufferPool pool(1);
+    wrap::PixelBuffer* first;
+    wrap::PixelBuffer* second;
+
+    {
+        auto lease = pool.acquire(400, 2);
+        first = lease.get();
+    }
+    {
+        auto lease = pool.acquire(400, 2);
+        ASSERT(lease.get() == first);
+
+        // Nothing idle is left to share.
+        auto other = pool.acquire(400, 2);
+        second = other.get();
+        ASSERT(second != first);
+    }
+
+    // The second buffer came back first and filled the only idle slot.
+    auto lease = pool.acquire(400, 2);
+    ASSERT(lease.get() == second);
+    ASSERT(pool.acquire(400, 2).get() != lease.get());
+    ASSERT(pool.acquire(200, 4).get() != lease.get());
+}
+
+TEST(PixelBufferPool_sharedLayout)
+{
+    jni::Object argb = bitmapConfig("ARGB_8888");
+    jni::Object rgb565 = bitmapConfig("RGB_565");
+    auto wide = wrap::android::graphics::Bitmap::createBitmap(200, 2, rgb565);
+    auto narrow = wrap::android::graphics::Bitmap::createBitmap(100, 2, argb);
+    wrap::PixelBufferPool pool;
+    wrap::PixelBuffer* buffer;
+
+    // Different configs, same stride and height: the raw bytes are shared.
+    {
+        auto lease = pool.acquire(wide);
+        buffer = lease.get();
+    }
+    ASSERT(pool.acquire(narrow).get() == buffer);
+}
+
+/*
+    wrap::preload Tests
+ */
+
+// Stands in for a generated wrapper, counting how often its Meta is built.
+struct CountedWrapper
+{
+    struct Meta
+    {
+        static Meta& data()
+        {
+            static Meta instance;
+            return instance;
+        }
+
+        jni::method_t putInt;
+
+    private:
+        Meta() : putInt(jni::Class("android/os/Bundle").getMethod("putInt", "(Ljava/lang/String;I)V"))
+        {
+            ++constructed;
+        }
+    };
+
+    static inline std::atomic<int> constructed{ 0 };
+};
+
+TEST(Preload_stubbedClasses)
+{
+    wrap::preload<wrap::android::database::Cursor, wrap::android::os::BaseBundle, wrap::android::os::Bundle,
+                  wrap::android::os::ParcelFileDescriptor, wrap::android::graphics::Bitmap, CountedWrapper>();
+
+    ASSERT(CountedWrapper::constructed == 1);
+
+    // Already resolved: using it looks nothing up again.
+    jni::Object bundle = jni::Class("android/os/Bundle").newInstance();
+    bundle.call<void>(CountedWrapper::Meta::data().putInt, "int", 42);
+    ASSERT(CountedWrapper::constructed == 1);
+
+    auto pfd = wrap::android::os::ParcelFileDescriptor::adoptFd(-1);
+    ASSERT(pfd.getFd() == -1);
+}
+
+TEST(Preload_missingClass)
+{
+    // No stand-in for Canvas: the worker's exception reaches this thread.
+    try
+    {
+        wrap::preload<wrap::android::os::Bundle, wrap::android::graphics::Canvas>();
+    }
+    catch (jni::NameResolutionException&)
+    {
+        ASSERT(1);
+        return;
+    }
+
+    ASSERT(0);
+}
+
+TEST(PreloadAll_missingClasses)
+{
+    // Most of the framework has no stand-in here.
+    try
+    {
+        wrap::preloadAll();
+    }
+    catch (jni::NameResolutionException&)
+    {
+        ASSERT(1);
+        return;
+    }
+
+    ASSERT(0);
+}
+
+/*
+    wrap::TextBatch Tests
+
+    These exercise the pure C++ parts and need no Java classes.
+ */
+
+TEST(TextMeasureCache_eviction)
+{
+    wrap::TextMeasureCache cache(2);
+    float width = 0;
+
+    cache.insert("a", 12.0f, 1.0f);
+    cache.insert("b", 12.0f, 2.0f);
+    cache.insert("c", 12.0f, 3.0f);
+
+    // The oldest entry goes first.
+    ASSERT(cache.size() == 2);
+    ASSERT(!cache.find("a", 12.0f, width));
+    ASSERT(cache.find("b", 12.0f, width) && width == 2.0f);
+    ASSERT(cache.find("c", 12.0f, width) && width == 3.0f);
+}
+
+TEST(TextMeasureCache_findRefreshes)
+{
+    wrap::TextMeasureCache cache(2);
+    float width = 0;
+
+    cache.insert("a", 12.0f, 1.0f);
+    cache.insert("b", 12.0f, 2.0f);
+    ASSERT(cache.find("a", 12.0f, width));
+    cache.insert("c", 12.0f, 3.0f);
+
+    // "a" was used more recently than "b", so "b" is evicted instead.
+    ASSERT(cache.find("a", 12.0f, width) && width == 1.0f);
+    ASSERT(!cache.find("b", 12.0f, width));
+    ASSERT(cache.find("c", 12.0f, width) && width == 3.0f);
+}
+
+TEST(TextMeasureCache_textSizeKeys)
+{
+    wrap::TextMeasureCache cache(4);
+    float width = 0;
+
+    cache.insert("label", 12.0f, 30.0f);
+    cache.insert("label", 24.0f, 60.0f);
+
+    ASSERT(cache.size() == 2);
+    ASSERT(cache.find("label", 12.0f, width) && width == 30.0f);
+    ASSERT(cache.find("label", 24.0f, width) && width == 60.0f);
+    ASSERT(!cache.find("label", 18.0f, width));
+
+    cache.clear();
+    ASSERT(cache.size() == 0);
+    ASSERT(!cache.find("label", 12.0f, width));
+}
+
+static std::vector<uint16_t> utf16(std::string const& text)
+{
+    std::vector<uint16_t> out;
+    wrap::appendUtf16(text, out);
+    return out;
+}
+
+TEST(appendUtf16_surrogates)
+{
+    // U+00E9, U+20AC and U+1F600: two, three and four byte sequences.
+    ASSERT(utf16("\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80") == std::vector<uint16_t>({ 0x00E9, 0x20AC, 0xD83D, 0xDE00 }));
+    // U+10FFFF is the last code point; anything above it is replaced.
+    ASSERT(utf16("\xF4\x8F\xBF\xBF") == std::vector<uint16_t>({ 0xDBFF, 0xDFFF }));
+    ASSERT(utf16("\xF4\x90\x80\x80") == std::vector<uint16_t>({ 0xFFFD }));
+
+    // Appends rather than replaces.
+    std::vector<uint16_t> out{ 'x' };
+    wrap::appendUtf16("y", out);
+    ASSERT(out == std::vector<uint16_t>({ 'x', 'y' }));
+}
+
+TEST(appendUtf16_truncated)
+{
+    // Cut short by the end of the text, or by a byte that does not continue it.
+    ASSERT(utf16("a\xE2\x82") == std::vector<uint16_t>({ 'a', 0xFFFD }));
+    ASSERT(utf16("\xF0\x9F\x98") == std::vector<uint16_t>({ 0xFFFD }));
+    ASSERT(utf16("\xE2\x82z") == std::vector<uint16_t>({ 0xFFFD, 'z' }));
+    ASSERT(utf16("\xC3\xE2\x82\xAC") == std::vector<uint16_t>({ 0xFFFD, 0x20AC }));
+}
+
+TEST(appendUtf16_invalidLead)
+{
+    // Stray continuation bytes and 0xF8-0xFF are replaced one byte at a time.
+    ASSERT(utf16("\x80") == std::vector<uint16_t>({ 0xFFFD }));
+    ASSERT(utf16("a\x80\xBF" "b") == std::vector<uint16_t>({ 'a', 0xFFFD, 0xFFFD, 'b' }));
+    ASSERT(utf16("\xF8\xFF") == std::vector<uint16_t>({ 0xFFFD, 0xFFFD }));
+    ASSERT(utf16("").empty());
+}
+
+/*
+    Throughput Measurements
+
+    These report figures for comparison; they do not pass or fail.
+ */
+
+template <class Function>
+static double secondsFor(Function&& function)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    function();
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char* what, double amount, const char* unit, double seconds)
+{
+    std::cout << "Measured " << std::left << std::setw(47) << what << "=> " << std::fixed << std::setprecision(1)
+              << amount / seconds << " " << unit << std::endl;
+}
+
+static void measureCursorStream()
+{
+    using Column = wrap::CursorReader::Column;
+    using Type = wrap::CursorReader::ColumnType;
+
+    const int rows = 200000;
+    const std::vector<Column> columns = { Column{ "_id", Type::Int }, Column{ "name", Type::String } };
+    int64_t sum = 0;
+
+    // Some work per row, so there is something to overlap with fetching.
+    auto consume = [&](const wrap::CursorReader& batch) {
+        for (std::size_t row = 0; row < batch.rows(); ++row)
+            sum += batch.getInt(0, row) + int64_t(batch.getString(1, row).size());
+    };
+
+    double plain = secondsFor([&] {
+        wrap::CursorReader reader(wrap::android::database::Cursor(newStub("wraptest/StubCursor", rows)), columns, 256);
+
+        while (reader.fetch() != 0)
+            consume(reader);
+    });
+
+    double streamed = secondsFor([&] {
+        wrap::CursorStream stream(wrap::android::database::Cursor(newStub("wraptest/StubCursor", rows)), columns, 256);
+
+        for (const wrap::CursorReader& batch : stream)
+            consume(batch);
+    });
+
+    report("CursorReader, rows", rows, "rows/s", plain);
+    report("CursorStream, rows", rows, "rows/s", streamed);
+}
+
+static void measureOutputStreamSink()
+{
+    const std::size_t total = 32 << 20;
+    const std::size_t chunk = 64 * 1024;
+    const std::size_t write = 4096;
+    std::string data = pattern(chunk);
+    std::string path = tempPath();
+
+    double sink = secondsFor([&] {
+        wrap::OutputStreamSink sink(newFileOutputStream(path), chunk);
+
+        for (std::size_t done = 0; done < total; done += write)
+            sink.write(data.data() + done % chunk, write);
+
+        sink.close();
+    });
+
+    // The straightforward alternative: a new byte[] for every chunk.
+    double arrays = secondsFor([&] {
+        wrap::java::io::OutputStream stream = newFileOutputStream(path);
+        auto& meta = wrap::java::io::OutputStream::Meta::data();
+
+        for (std::size_t done = 0; done < total; done += chunk)
+        {
+            jni::Array<jni::byte_t> array((long) chunk);
+            array.setRegion(0, long(chunk), reinterpret_cast<const jni::byte_t*>(data.data()));
+            meta.write1.call(stream.object(), array);
+        }
+
+        stream.close();
+    });
+
+    ::unlink(path.c_str());
+
+    report("OutputStreamSink, 4 KiB writes", total / 1e6, "MB/s", sink);
+    report("new byte[] per 64 KiB chunk", total / 1e6, "MB/s", arrays);
+}
+
+static void measureStreamReader()
+{
+    const std::size_t total = 32 << 20;
+    const std::size_t chunk = 64 * 1024;
+    std::string path = tempPath();
+    std::vector<char> buffer(chunk);
+    std::size_t sum = 0;
+
+    writeFile(path, pattern(total));
+
+    double copy = secondsFor([&] {
+        wrap::StreamReader reader(newFileInputStream(path), chunk);
+
+        while (std::size_t count = reader.read(buffer.data(), chunk))
+            sum += std::size_t(buffer[count - 1]);
+
+        reader.close();
+    });
+
+    double critical = secondsFor([&] {
+        wrap::StreamReader reader(newFileInputStream(path), chunk);
+
+        while (reader.readCritical([&](const jni::byte_t* bytes, std::size_t count) { sum += bytes[count - 1]; }) != 0)
+            ;
+
+        reader.close();
+    });
+
+    ::unlink(path.c_str());
+
+    report("StreamReader, region copy", total / 1e6, "MB/s", copy);
+    report("StreamReader, critical access", total / 1e6, "MB/s", critical);
+}
+
+int main()
+{
+    jni::Vm vm;
+
+    // wrap::impl::MethodId Tests
+    RUN_TEST(MethodId_signatureMatches);
+    RUN_TEST(MethodId_call);
+    RUN_TEST(MethodId_rejectsMismatch);
+    RUN_TEST(StaticMethodId_rejectsMismatch);
+
+    // wrap::CursorReader Tests
+    RUN_TEST(CursorReader_fetchBatches);
+    RUN_TEST(CursorReader_unknownColumn);
+    RUN_TEST(CursorReader_javaException);
+
+    // wrap::CursorStream Tests
+    RUN_TEST(CursorStream_batchOrder);
+    RUN_TEST(CursorStream_slowConsumer);
+    RUN_TEST(CursorStream_cancel);
+    RUN_TEST(CursorStream_closeWhileBlocked);
+    RUN_TEST(CursorStream_javaException);
+
+    // wrap::ListRange Tests
+    RUN_TEST(ListRange_temporaryList);
+
+    // wrap::NativeFdHandle Tests
+    RUN_TEST(NativeFdHandle_detach);
+    RUN_TEST(NativeFdHandle_dup);
+    RUN_TEST(NativeFdHandle_toParcelFileDescriptor);
+    RUN_TEST(NativeFdHandle_partialWritev);
+    RUN_TEST(NativeFdHandle_mapUnalignedOffset);
+    RUN_TEST(NativeFdHandle_mapEmptyFile);
+    RUN_TEST(NativeFdHandle_mapNegativeOffset);
+
+    // wrap::MappedFile Tests
+    RUN_TEST(MappedFile_nativeReadWrite);
+    RUN_TEST(MappedFile_readOnly);
+    RUN_TEST(MappedFile_fromFileChannel);
+    RUN_TEST(MappedFile_fromHeapBuffer);
+
+    // wrap::OutputStreamSink Tests
+    RUN_TEST(OutputStreamSink_chunkSizes);
+    RUN_TEST(OutputStreamSink_destructorWrites);
+
+    // wrap::StreamReader Tests
+    RUN_TEST(StreamReader_readFully);
+    RUN_TEST(StreamReader_shortStream);
+    RUN_TEST(StreamReader_skipAndAvailable);
+    RUN_TEST(StreamReader_readCritical);
+
+    // wrap::PixelBufferPool Tests
+    RUN_TEST(PixelBufferPool_roundTrip);
+    RUN_TEST(PixelBufferPool_leaseReuse);
+    RUN_TEST(PixelBufferPool_sharedLayout);
+
+    // wrap::snapshot Tests
+    RUN_TEST(Snapshot_point);
+    RUN_TEST(Snapshot_displayMetrics);
+    RUN_TEST(Snapshot_bundle);
+
+    // wrap::preload Tests
+    RUN_TEST(Preload_stubbedClasses);
+    RUN_TEST(Preload_missingClass);
+    RUN_TEST(PreloadAll_missingClasses);
+
+    // wrap::TextBatch Tests
+    RUN_TEST(TextMeasureCache_eviction);
+    RUN_TEST(TextMeasureCache_findRefreshes);
+    RUN_TEST(TextMeasureCache_textSizeKeys);
+    RUN_TEST(appendUtf16_surrogates);
+    RUN_TEST(appendUtf16_truncated);
+    RUN_TEST(appendUtf16_invalidLead);
+
+    // Throughput Measurements
+    measureCursorStream();
+    measureOutputStreamSink();
+    measureStreamReader();
+
+    return 0;
+}